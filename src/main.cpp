@@ -1,4 +1,13 @@
 #include "sahne.h"
+#include "sahne.hpp"
+#include "sahne_task_pool.hpp"
+#include "sahne_tree_walk.hpp"
+#include "sahne_timer_wheel.hpp"
+#include "sahne_group_commit.hpp"
+#include "sahne_checksum.hpp"
+#include "sahne_broadcast.hpp"
+#include "sahne_metrics.hpp"
+#include "sahne_rpc.hpp"
 
 // Standart C++ kütüphaneleri (Sahne64 üzerinde veya uyumlu bir şekilde implemente edildiği varsayılır)
 #include <iostream> // std::cout, std::cerr, std::endl
@@ -6,8 +15,11 @@
 #include <string>   // std::string
 #include <cstring>  // strlen (veya C++20 string::length)
 #include <chrono>   // std::chrono::duration, std::chrono::milliseconds
+#include <atomic>   // std::atomic
+#include <thread>   // std::thread
 #include <cstdint>  // uint*_t, int*_t (güvenlik için)
 #include <cstdio>   // fprintf (fallback için)
+#include <algorithm> // std::sort, std::min
 
 
 // Yeni bir görevde çalışacak örnek fonksiyon (basitçe çıkış yapar)
@@ -56,6 +68,52 @@ int main() {
     }
 
 
+    // --- Yeni Özellik: Çekirdek İstatistikleri ve Bellek Baskısı (C++) ---
+    KernelStats_t stats{};
+    err = sahne::kernel::get_stats(stats);
+    if (err == SAHNE_SUCCESS) {
+        std::cout << "\nKernel stats v" << stats.version << ": uptime " << stats.uptime_seconds << "s, free "
+                  << stats.free_memory_bytes << "/" << stats.total_memory_bytes << " bytes, pressure " << stats.memory_pressure
+                  << "; task mem " << stats.task_memory_bytes << " bytes, handles " << stats.task_handle_count
+                  << ", cpu " << stats.task_cpu_time_ns << "ns" << std::endl;
+
+        // Tek anlık görüntü ile anahtar başına sahne_kernel_get_info çağrılarının karşılaştırılması
+        const int rounds = 1000;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; ++i) {
+            sahne::kernel::get_stats(stats);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; ++i) {
+            for (uint32_t key = SAHNE_KERNEL_INFO_VERSION_MAJOR; key <= SAHNE_KERNEL_INFO_FREE_MEMORY_BYTES; ++key) {
+                uint64_t value = 0;
+                sahne_kernel_get_info(key, &value);
+            }
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        std::cout << "  " << rounds << "x get_stats: " << std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count()
+                  << "us, " << rounds << "x 7 get_info: " << std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count()
+                  << "us" << std::endl;
+    } else {
+        std::cerr << "Failed to get kernel stats, error: " << err << std::endl;
+    }
+
+    sahne::memory::PressureMonitor pressure;
+    err = pressure.open(SAHNE_MEM_PRESSURE_LOW);
+    if (err == SAHNE_SUCCESS) {
+        // Gerçek bir uygulamada handle poll döngüsüne eklenir; burada yalnızca bekleyen bildirim kontrol edilir
+        PollEntry_t pressure_entry{};
+        pressure_entry.handle = pressure.handle();
+        pressure_entry.events_in = SAHNE_POLL_READABLE;
+        uint32_t level = SAHNE_MEM_PRESSURE_NONE;
+        if (sahne_poll(&pressure_entry, 1, 0) > 0 && pressure.read_level(&level) == SAHNE_SUCCESS) {
+            std::cout << "Memory pressure level: " << level << " (caches should shrink)" << std::endl;
+        }
+    } else {
+        std::cerr << "Failed to open memory pressure handle, error: " << err << std::endl;
+    }
+
+
     // --- Yeni Özellik: Kaynakta Konumlanma ve Durum Alma (Seek & Stat) ---
     sahne_handle_t seekable_file_handle = 0;
     std::string file_res_name = "sahne://app_data/log_cpp.txt"; // C++ örneği için farklı isim
@@ -137,6 +195,153 @@ int main() {
         std::cerr << "Failed to spawn child task, error: " << err << std::endl;
     }
 
+    {
+        // Gözetmen: 10k çocuk görevin sonlanmasını toplama. Çocuk başına sahne_task_wait_for_exit ile
+        // tek çağrıda toplu sahne_task_wait_many (reap_children) karşılaştırılır.
+        const size_t children = 10000;
+        for (bool bulk : {false, true}) {
+            std::vector<sahne_task_id_t> ids;
+            ids.reserve(children);
+            sahne_error_t sup_err = SAHNE_SUCCESS;
+            for (size_t i = 0; i < children && sup_err == SAHNE_SUCCESS; ++i) {
+                sahne_task_id_t id = 0;
+                sup_err = sahne_task_spawn(child_code_handle, nullptr, 0, nullptr, 0, &id);
+                if (sup_err == SAHNE_SUCCESS) {
+                    ids.push_back(id);
+                }
+            }
+            size_t reaped = 0;
+            size_t calls = 0;
+            auto start = std::chrono::steady_clock::now();
+            if (bulk) {
+                std::vector<TaskExitStatus_t> exited;
+                while (reaped < ids.size()) {
+                    sahne_error_t reap_err = sahne::task::reap_children(exited, 1024, -1);
+                    ++calls;
+                    if (reap_err != SAHNE_SUCCESS) {
+                        sup_err = reap_err;
+                        break;
+                    }
+                    reaped += exited.size();
+                }
+            } else {
+                for (sahne_task_id_t id : ids) {
+                    int32_t code = 0;
+                    ++calls;
+                    if (sahne_task_wait_for_exit(id, &code) == SAHNE_SUCCESS) {
+                        ++reaped;
+                    }
+                }
+            }
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            if (sup_err != SAHNE_SUCCESS && reaped == 0) {
+                std::cerr << "Supervisor benchmark failed, error: " << sup_err << std::endl;
+                break;
+            }
+            std::cout << (bulk ? "bulk reap (wait_many)" : "per-child wait       ") << ": " << reaped << " exits in " << ms
+                      << " ms, " << calls << " calls" << std::endl;
+        }
+    }
+
+
+    // --- Yeni Özellik: Görev Havuzu (C++) ---
+    // Kısa ömürlü işler için her seferinde spawn/wait yapmak yerine önceden başlatılmış işçiler kullanılır.
+    // İşçi kodu sahne::task_pool::run_worker döngüsünü çalıştırmalıdır.
+    std::cout << "\n--- Görev Havuzu Örneği (C++) ---\n";
+    {
+        sahne::task_pool::TaskPool pool;
+        sahne::task_pool::TaskPool::Options pool_options;
+        pool_options.code_handle = child_code_handle;
+        pool_options.workers = 4;
+        err = pool.start(pool_options);
+        if (err == SAHNE_SUCCESS) {
+            size_t jobs_done = 0;
+            for (uint32_t job = 0; job < 16; ++job) {
+                pool.submit(reinterpret_cast<const uint8_t*>(&job), sizeof(job), nullptr, 0,
+                            [&jobs_done](sahne_error_t status, int32_t) {
+                                if (status == SAHNE_SUCCESS) {
+                                    ++jobs_done;
+                                } else {
+                                    std::cerr << "Pool job failed, error: " << status << std::endl;
+                                }
+                            });
+            }
+            while (pool.in_flight() != 0 || pool.queued() != 0) {
+                err = pool.poll(-1);
+                if (err != SAHNE_SUCCESS) {
+                    std::cerr << "Task pool poll failed, error: " << err << std::endl;
+                    break;
+                }
+            }
+            std::cout << "Task pool completed " << jobs_done << " jobs." << std::endl;
+        } else {
+            std::cerr << "Failed to start task pool, error: " << err << std::endl;
+        }
+    } // Havuz yok edilirken işçiler kapatılır ve beklenir
+    {
+        // Soğuk sahne_task_spawn + sahne_task_wait_for_exit, şablondan (copy-on-write) başlatma ve sıcak havuz:
+        // iş başına ortalama gecikme ve jobs/s. Soğuk/şablon yolunda spawn çağrısının dönüş süresi ayrıca raporlanır.
+        const int jobs = 2000;
+        sahne_handle_t template_handle = 0;
+        if (sahne_task_template_create(child_code_handle, nullptr, 0, nullptr, 0, &template_handle) != SAHNE_SUCCESS) {
+            template_handle = 0; // Şablon desteklenmiyor: yalnızca soğuk ve havuz yolları ölçülür
+        }
+        for (int mode = 0; mode < 3; ++mode) {
+            const char* labels[] = {"cold spawn+wait", "template spawn ", "warm task pool "};
+            if (mode == 1 && template_handle == 0) {
+                continue;
+            }
+            sahne_error_t bench_err = SAHNE_SUCCESS;
+            double spawn_us = 0;
+            int done = 0;
+            auto start = std::chrono::steady_clock::now();
+            if (mode < 2) {
+                for (int job = 0; job < jobs && bench_err == SAHNE_SUCCESS; ++job) {
+                    sahne_task_id_t id = 0;
+                    auto spawn_start = std::chrono::steady_clock::now();
+                    bench_err = mode == 0
+                        ? sahne_task_spawn(child_code_handle, reinterpret_cast<const uint8_t*>(&job), sizeof(job), nullptr, 0, &id)
+                        : sahne_task_spawn_from_template(template_handle, reinterpret_cast<const uint8_t*>(&job), sizeof(job), nullptr, 0, &id);
+                    spawn_us += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - spawn_start).count();
+                    int32_t exit_code = 0;
+                    if (bench_err == SAHNE_SUCCESS) {
+                        bench_err = sahne_task_wait_for_exit(id, &exit_code);
+                    }
+                    done += bench_err == SAHNE_SUCCESS;
+                }
+            } else {
+                sahne::task_pool::TaskPool bench_pool;
+                sahne::task_pool::TaskPool::Options bench_options;
+                bench_options.code_handle = child_code_handle;
+                bench_options.template_handle = template_handle;
+                bench_options.workers = std::max(1u, std::thread::hardware_concurrency());
+                bench_err = bench_pool.start(bench_options);
+                start = std::chrono::steady_clock::now(); // İşçilerin başlatılması ölçüme dahil değil
+                for (int job = 0; job < jobs && bench_err == SAHNE_SUCCESS; ++job) {
+                    bench_err = bench_pool.submit(reinterpret_cast<const uint8_t*>(&job), sizeof(job), nullptr, 0,
+                                                  [&done](sahne_error_t status, int32_t) { done += status == SAHNE_SUCCESS; });
+                }
+                while (bench_err == SAHNE_SUCCESS && (bench_pool.in_flight() != 0 || bench_pool.queued() != 0)) {
+                    bench_err = bench_pool.poll(-1);
+                }
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (bench_err != SAHNE_SUCCESS) {
+                std::cerr << labels[mode] << " benchmark failed, error: " << bench_err << std::endl;
+                continue;
+            }
+            std::cout << labels[mode] << ": " << (seconds > 0 ? done / seconds : 0.0) << " jobs/s, "
+                      << (done > 0 ? seconds * 1e6 / done : 0.0) << " us/job";
+            if (mode < 2) {
+                std::cout << ", spawn call " << spawn_us / jobs << " us";
+            }
+            std::cout << std::endl;
+        }
+        if (template_handle != 0) {
+            sahne_resource_release(template_handle);
+        }
+    }
+
 
     // --- Yeni Özellik: Mesajlaşma Kanalları (C++) ---
     sahne_handle_t channel_tx_handle = 0;
@@ -170,6 +375,83 @@ int main() {
             std::cerr << "Failed to send message on channel " << static_cast<unsigned long long>(channel_tx_handle) << ", error: " << err << std::endl;
         }
 
+        // Toplu gönderim/alım: birden çok küçük mesaj tek sistem çağrısıyla taşınır
+        sahne::messaging::FrameBuilder batch(4096);
+        for (int i = 0; i < 16; ++i) {
+            batch.push("telemetry sample " + std::to_string(i));
+        }
+        size_t sent_count = 0;
+        err = batch.flush(channel_tx_handle, &sent_count);
+        if (err == SAHNE_SUCCESS) {
+            std::cout << "Sent " << sent_count << " framed messages in one call." << std::endl;
+
+            sahne::messaging::ReceiveBatch rx_batch(4096, 64);
+            err = rx_batch.receive(channel_tx_handle);
+            if (err == SAHNE_SUCCESS) {
+                std::cout << "Received " << rx_batch.count() << " messages in one call." << std::endl;
+                for (size_t i = 0; i < rx_batch.count(); ++i) {
+                    std::cout << "  [" << i << "] '" << std::string(reinterpret_cast<const char*>(rx_batch.message_data(i)), rx_batch.message_len(i)) << "'" << std::endl;
+                }
+            } else {
+                std::cerr << "Failed to receive message batch, error: " << err << std::endl;
+            }
+        } else {
+            std::cerr << "Failed to send message batch, error: " << err << std::endl;
+        }
+
+        // Mesaj boyutuna göre msgs/s: tek mesajlık sahne_channel_send/receive ve toplu send_many/receive_many
+        sahne_handle_t bench_tx = 0;
+        sahne_handle_t bench_rx = 0;
+        if (sahne_channel_create_pair(&bench_tx, &bench_rx) == SAHNE_SUCCESS) {
+            const size_t messages = 200000;
+            const size_t burst = 64; // Kanal kuyruğunu taşırmamak için gönder/al turu başına mesaj
+            for (size_t msg_size : {32, 64, 128, 512}) {
+                std::vector<uint8_t> payload(msg_size, 0x5A);
+                std::vector<uint8_t> single_rx(msg_size);
+                sahne::messaging::FrameBuilder frames(burst * (msg_size + 8));
+                sahne::messaging::ReceiveBatch rx_frames(burst * (msg_size + 8), burst);
+                for (bool batched : {false, true}) {
+                    size_t moved = 0;
+                    sahne_error_t bench_err = SAHNE_SUCCESS;
+                    auto start = std::chrono::steady_clock::now();
+                    while (moved < messages && bench_err == SAHNE_SUCCESS) {
+                        if (batched) {
+                            for (size_t i = 0; i < burst; ++i) {
+                                frames.push(payload.data(), payload.size());
+                            }
+                            size_t sent = 0;
+                            while (bench_err == SAHNE_SUCCESS && !frames.empty()) {
+                                bench_err = frames.flush(bench_tx, &sent);
+                            }
+                            for (size_t got = 0; bench_err == SAHNE_SUCCESS && got < burst; got += rx_frames.count()) {
+                                bench_err = rx_frames.receive(bench_rx);
+                            }
+                        } else {
+                            for (size_t i = 0; bench_err == SAHNE_SUCCESS && i < burst; ++i) {
+                                bench_err = sahne_channel_send(bench_tx, payload.data(), payload.size());
+                            }
+                            for (size_t i = 0; bench_err == SAHNE_SUCCESS && i < burst; ++i) {
+                                size_t got = 0;
+                                bench_err = sahne_channel_receive(bench_rx, single_rx.data(), single_rx.size(), &got);
+                            }
+                        }
+                        moved += burst;
+                    }
+                    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    if (bench_err != SAHNE_SUCCESS) {
+                        std::cerr << "Channel benchmark failed at " << msg_size << " bytes, error: " << bench_err << std::endl;
+                        break;
+                    }
+                    std::cout << (batched ? "send_many/receive_many" : "send/receive          ") << " " << msg_size
+                              << " B: " << (seconds > 0 ? static_cast<double>(moved) / seconds : 0.0) << " msgs/s" << std::endl;
+                }
+            }
+            sahne_resource_release(bench_tx);
+            sahne_resource_release(bench_rx);
+        } else {
+            std::cerr << "Skipping channel batching benchmark." << std::endl;
+        }
+
         // Kanal handle'ını serbest bırak
         err = sahne_resource_release(channel_tx_handle);
         if (err == SAHNE_SUCCESS) {
@@ -183,6 +465,748 @@ int main() {
     }
 
 
+    // --- Yeni Özellik: Kanal Üzerinden Handle ve Paylaşımlı Tampon Devri (C++) ---
+    {
+        // Büyük yük aktarım gecikmesi: 64 KiB'lık sahne_channel_send parçalarıyla kopyalama ve
+        // paylaşımlı bellek handle'ını devretme (alıcı eşler ve ilk/son byte'a dokunur)
+        sahne_handle_t xfer_tx = 0;
+        sahne_handle_t xfer_rx = 0;
+        err = sahne_channel_create_pair(&xfer_tx, &xfer_rx);
+        if (err == SAHNE_SUCCESS) {
+            const size_t chunk = 64 * 1024;
+            const int rounds = 20;
+            std::vector<uint8_t> rx_chunk(chunk);
+            for (size_t payload_size : {size_t{64} << 10, size_t{1} << 20, size_t{16} << 20, size_t{64} << 20}) {
+                std::vector<uint8_t> payload(payload_size, 0xA5);
+                for (bool by_handle : {false, true}) {
+                    sahne_error_t xfer_err = SAHNE_SUCCESS;
+                    uint64_t checksum = 0;
+                    auto start = std::chrono::steady_clock::now();
+                    for (int round = 0; round < rounds && xfer_err == SAHNE_SUCCESS; ++round) {
+                        if (by_handle) {
+                            sahne::memory::SharedBuffer producer;
+                            xfer_err = producer.create(payload_size);
+                            if (xfer_err != SAHNE_SUCCESS) {
+                                break;
+                            }
+                            producer.data()[0] = static_cast<uint8_t>(round); // Üretici tamponu doldurmuş varsayılır
+                            sahne_handle_t shared = producer.release_handle();
+                            xfer_err = sahne::messaging::send_shared_buffer(xfer_tx, shared, payload_size);
+                            if (xfer_err != SAHNE_SUCCESS) {
+                                sahne_resource_release(shared);
+                                break;
+                            }
+                            sahne_handle_t received = 0;
+                            size_t received_len = 0;
+                            xfer_err = sahne::messaging::receive_shared_buffer(xfer_rx, &received, &received_len);
+                            sahne::memory::SharedBuffer consumer;
+                            if (xfer_err == SAHNE_SUCCESS) {
+                                xfer_err = consumer.map_existing(received, received_len);
+                            }
+                            if (xfer_err == SAHNE_SUCCESS) {
+                                checksum += consumer.data()[0] + consumer.data()[received_len - 1];
+                            }
+                        } else {
+                            // Her parça gönderilip hemen alınır (kanal kuyruğu taşmasın)
+                            for (size_t offset = 0; offset < payload_size && xfer_err == SAHNE_SUCCESS; offset += chunk) {
+                                size_t n = std::min(chunk, payload_size - offset);
+                                xfer_err = sahne_channel_send(xfer_tx, payload.data() + offset, n);
+                                size_t got = 0;
+                                if (xfer_err == SAHNE_SUCCESS) {
+                                    xfer_err = sahne_channel_receive(xfer_rx, rx_chunk.data(), rx_chunk.size(), &got);
+                                }
+                                if (xfer_err == SAHNE_SUCCESS && got != 0) {
+                                    checksum += rx_chunk[got - 1];
+                                }
+                            }
+                        }
+                    }
+                    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+                    if (xfer_err != SAHNE_SUCCESS) {
+                        std::cerr << "Payload transfer failed at " << payload_size << " bytes, error: " << xfer_err << std::endl;
+                        break;
+                    }
+                    std::cout << (by_handle ? "shared handle " : "copy via send ") << payload_size << " B: " << us
+                              << " us/transfer (checksum " << checksum << ")" << std::endl;
+                }
+            }
+            sahne_resource_release(xfer_tx);
+            sahne_resource_release(xfer_rx);
+        } else {
+            std::cerr << "\nSkipping payload transfer benchmark, error: " << err << std::endl;
+        }
+    }
+
+
+    // --- Yeni Özellik: İstek/Yanıt (RPC) Katmanı (C++) ---
+    {
+        // req/s ve kuyruk gecikmesi (p50/p99/p99.9): düz senkron gönder-sonra-al ile derinliği 16/64 olan boru hattı.
+        // Sunucu 4 işçiyle aynı görevde çalışır; işleyici yükü aynen geri döner.
+        sahne_handle_t rpc_client_end = 0;
+        sahne_handle_t rpc_server_end = 0;
+        err = sahne_channel_create_pair(&rpc_client_end, &rpc_server_end);
+        if (err == SAHNE_SUCCESS) {
+            const uint32_t kEcho = 1;
+            sahne::rpc::Server server(4);
+            server.register_handler(kEcho, [](const sahne::rpc::RequestContext&, const uint8_t* payload, size_t len, std::vector<uint8_t>& response) {
+                response.assign(payload, payload + len);
+                return SAHNE_SUCCESS;
+            });
+            server.add_channel(rpc_server_end);
+            std::thread server_thread([&server] { server.run(); });
+
+            sahne::rpc::Client client(rpc_client_end);
+            const size_t requests = 20000;
+            const uint8_t request_payload[64] = {};
+            for (size_t depth : {size_t{1}, size_t{16}, size_t{64}}) {
+                std::vector<double> latencies_us;
+                latencies_us.reserve(requests);
+                sahne_error_t rpc_err = SAHNE_SUCCESS;
+                auto start = std::chrono::steady_clock::now();
+                if (depth == 1) {
+                    // İstemci nesnesi olmadan: tek istek gönder, yanıtı bloklayarak al
+                    std::vector<uint8_t> request;
+                    std::vector<uint8_t> response(4096);
+                    SahneRpcHeader_t header{};
+                    header.version = SAHNE_RPC_VERSION;
+                    header.kind = SAHNE_RPC_KIND_REQUEST;
+                    header.method = kEcho;
+                    header.payload_len = sizeof(request_payload);
+                    for (size_t i = 0; i < requests && rpc_err == SAHNE_SUCCESS; ++i) {
+                        auto sent = std::chrono::steady_clock::now();
+                        header.request_id = i + 1;
+                        sahne::rpc::encode(header, request_payload, request);
+                        rpc_err = sahne_channel_send(rpc_client_end, request.data(), request.size());
+                        size_t got = 0;
+                        if (rpc_err == SAHNE_SUCCESS) {
+                            rpc_err = sahne_channel_receive(rpc_client_end, response.data(), response.size(), &got);
+                        }
+                        SahneRpcHeader_t reply{};
+                        const uint8_t* reply_payload = nullptr;
+                        if (rpc_err == SAHNE_SUCCESS) {
+                            rpc_err = sahne::rpc::decode(response.data(), got, &reply, &reply_payload);
+                        }
+                        if (rpc_err == SAHNE_SUCCESS) {
+                            rpc_err = static_cast<sahne_error_t>(reply.status);
+                        }
+                        latencies_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - sent).count());
+                    }
+                } else {
+                    size_t issued = 0;
+                    size_t failed = 0;
+                    while ((issued < requests || client.pending() != 0) && rpc_err == SAHNE_SUCCESS) {
+                        while (issued < requests && client.pending() < depth) {
+                            auto sent = std::chrono::steady_clock::now();
+                            rpc_err = client.call_async(kEcho, request_payload, sizeof(request_payload), 0,
+                                [&latencies_us, &failed, sent](sahne_error_t status, const uint8_t*, size_t) {
+                                    if (status != SAHNE_SUCCESS) {
+                                        ++failed;
+                                    }
+                                    latencies_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - sent).count());
+                                });
+                            ++issued;
+                        }
+                        if (rpc_err == SAHNE_SUCCESS) {
+                            rpc_err = client.poll(-1);
+                        }
+                    }
+                    if (rpc_err == SAHNE_SUCCESS && failed != 0) {
+                        rpc_err = SAHNE_ERROR_COMMUNICATION_ERROR;
+                    }
+                }
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                if (rpc_err != SAHNE_SUCCESS || latencies_us.empty()) {
+                    std::cerr << "RPC benchmark failed at depth " << depth << ", error: " << rpc_err << std::endl;
+                    break;
+                }
+                std::sort(latencies_us.begin(), latencies_us.end());
+                auto percentile = [&latencies_us](double p) {
+                    return latencies_us[std::min(latencies_us.size() - 1, static_cast<size_t>(p * static_cast<double>(latencies_us.size())))];
+                };
+                std::cout << (depth == 1 ? "sync send+receive" : "rpc pipelined    ") << " depth=" << depth << ": "
+                          << (seconds > 0 ? static_cast<double>(latencies_us.size()) / seconds : 0.0) << " req/s, p50 "
+                          << percentile(0.50) << "us, p99 " << percentile(0.99) << "us, p99.9 " << percentile(0.999) << "us" << std::endl;
+            }
+
+            server.stop();
+            server_thread.join();
+            sahne_resource_release(rpc_client_end);
+            sahne_resource_release(rpc_server_end);
+        } else {
+            std::cerr << "\nSkipping RPC benchmark, error: " << err << std::endl;
+        }
+    }
+
+
+    // --- Yeni Özellik: Hiyerarşik Zamanlayıcı Çarkı (C++) ---
+    {
+        // Kaskad sınırlarına denk gelen zamanlayıcılar tam dolma tikinde ateşlenmeli (64, 4096, 262144 katları)
+        size_t boundary_errors = 0;
+        for (uint64_t ticks : {uint64_t{64}, uint64_t{128}, uint64_t{4096}, uint64_t{8192}, uint64_t{262144}, uint64_t{524288}}) {
+            for (uint64_t start : {uint64_t{0}, uint64_t{1}, uint64_t{63}}) {
+                sahne::timer::TimerWheel wheel(1, 0);
+                wheel.advance(start, [](uint64_t) {});
+                wheel.insert(ticks, 0);
+                uint64_t fired_at = 0;
+                for (uint64_t t = start + 1; t <= start + ticks + 1 && fired_at == 0; ++t) {
+                    wheel.advance(t, [&](uint64_t) { fired_at = t; });
+                }
+                if (fired_at != start + ticks) {
+                    std::cerr << "Timer wheel: " << ticks << " ticks from " << start << " fired at " << fired_at << std::endl;
+                    ++boundary_errors;
+                }
+            }
+        }
+        std::cout << "\nTimer wheel boundary check: " << (boundary_errors == 0 ? "ok" : "FAILED") << std::endl;
+
+        // Kaba kuvvet referansına karşı rastgele ekleme/iptal/ilerletme: her zamanlayıcı tam dolma tikinde,
+        // yalnızca bir kez ateşlenmeli; geri çağırma içinden iptal ve ekleme de yapılır.
+        {
+            sahne::timer::TimerWheel wheel(1, 0);
+            std::vector<uint64_t> expected;           // token -> dolma tiki (0: iptal edildi veya ateşlendi)
+            std::vector<sahne::timer::TimerId> ids;   // token -> kimlik
+            size_t live = 0;
+            size_t reference_errors = 0;
+            uint64_t now = 0;
+            uint64_t x = 0x9E3779B97F4A7C15ull;
+            auto next_random = [&x] { x ^= x << 13; x ^= x >> 7; x ^= x << 17; return x; };
+            auto insert = [&](uint64_t ticks) {
+                ids.push_back(wheel.insert(ticks, expected.size()));
+                expected.push_back(now + ticks);
+                ++live;
+            };
+            auto on_fire = [&](uint64_t token) {
+                if (token >= expected.size() || expected[token] != now) {
+                    ++reference_errors;
+                    return;
+                }
+                expected[token] = 0;
+                --live;
+                if (next_random() % 8 == 0) {
+                    // Aynı tikte dolan başka bir zamanlayıcıyı (varsa) geri çağırmadan iptal et
+                    for (uint64_t t = token + 1; t < expected.size() && t < token + 64; ++t) {
+                        if (expected[t] == now && wheel.cancel(ids[t])) {
+                            expected[t] = 0;
+                            --live;
+                            break;
+                        }
+                    }
+                    insert(1 + next_random() % 5000);
+                }
+            };
+            for (int step = 0; step < 20000; ++step) {
+                uint64_t r = next_random() % 10;
+                if (r < 5) {
+                    insert(r == 0 ? 1 + next_random() % 20000000 : 1 + next_random() % 5000);
+                } else if (r < 7 && live != 0) {
+                    uint64_t token = next_random() % expected.size();
+                    bool pending = expected[token] != 0;
+                    if (wheel.cancel(ids[token]) != pending) {
+                        ++reference_errors;
+                    }
+                    if (pending) {
+                        expected[token] = 0;
+                        --live;
+                    }
+                } else {
+                    for (uint64_t end = now + 1 + next_random() % 100; now < end;) {
+                        ++now;
+                        wheel.advance(now, on_fire);
+                    }
+                }
+                if (wheel.size() != live) {
+                    ++reference_errors;
+                    break;
+                }
+            }
+            while (!wheel.empty() && reference_errors == 0) {
+                uint64_t next_ns = 0;
+                wheel.next_deadline_ns(&next_ns);
+                for (; now < next_ns; ) {
+                    ++now;
+                    wheel.advance(now, on_fire);
+                }
+            }
+            for (uint64_t e : expected) {
+                reference_errors += e != 0;
+            }
+            std::cout << "Timer wheel reference check (" << expected.size() << " timers): "
+                      << (reference_errors == 0 ? "ok" : "FAILED") << std::endl;
+        }
+
+        // Ekleme/iptal/ateşleme hızı: 1M zamanlayıcı (1 µs tik, 1 µs..1 s gecikme), yarısı iptal edilir
+        const size_t timers = 1000000;
+        sahne::timer::TimerWheel wheel(1000, 0, timers);
+        std::vector<sahne::timer::TimerId> ids;
+        ids.reserve(timers);
+        uint64_t x = 0x2545F4914F6CDD1Dull;
+        auto t0 = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < timers; ++i) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17; // xorshift64
+            ids.push_back(wheel.insert(1000 + (x % 1000000) * 1000, i));
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        size_t cancelled = 0;
+        for (size_t i = 0; i < timers; i += 2) {
+            cancelled += wheel.cancel(ids[i]);
+        }
+        auto t2 = std::chrono::steady_clock::now();
+        uint64_t token_sum = 0;
+        size_t fired = 0;
+        for (uint64_t now_ns = 0; !wheel.empty(); now_ns += 1000000) { // 1 ms adımlarla ilerle
+            fired += wheel.advance(now_ns, [&token_sum](uint64_t token) { token_sum += token; });
+        }
+        auto t3 = std::chrono::steady_clock::now();
+        auto rate = [](size_t n, std::chrono::steady_clock::duration d) {
+            double seconds = std::chrono::duration<double>(d).count();
+            return seconds > 0 ? static_cast<double>(n) / seconds : 0.0;
+        };
+        std::cout << "Timer wheel: insert " << rate(timers, t1 - t0) << "/s, cancel " << rate(cancelled, t2 - t1)
+                  << "/s, fire " << rate(fired, t3 - t2) << "/s (" << fired << " fired, token sum " << token_sum << ")" << std::endl;
+    }
+
+
+    // --- Yeni Özellik: Çekirdek İçi Kopyalama (copy_range) (C++) ---
+    {
+        sahne_handle_t copy_src = 0;
+        sahne_handle_t copy_dst = 0;
+        std::string src_name = "sahne://tmp/copy_src";
+        std::string dst_name = "sahne://tmp/copy_dst";
+        err = sahne_resource_acquire(reinterpret_cast<const uint8_t*>(src_name.c_str()), src_name.length(), SAHNE_MODE_READ, &copy_src);
+        if (err == SAHNE_SUCCESS) {
+            err = sahne_resource_acquire(reinterpret_cast<const uint8_t*>(dst_name.c_str()), dst_name.length(),
+                                         SAHNE_MODE_WRITE | SAHNE_MODE_CREATE | SAHNE_MODE_TRUNCATE, &copy_dst);
+        }
+        if (err == SAHNE_SUCCESS) {
+            // 4 KiB'tan 1 GiB'a kadar kopyalama verimi (veri kullanıcı alanına taşınmaz)
+            const uint64_t sizes[] = {uint64_t{4} << 10, uint64_t{64} << 10, uint64_t{1} << 20,
+                                      uint64_t{16} << 20, uint64_t{256} << 20, uint64_t{1} << 30};
+            for (uint64_t size : sizes) {
+                uint64_t copied = 0;
+                auto start = std::chrono::steady_clock::now();
+                err = sahne::resource::copy_all(copy_src, 0, copy_dst, 0, size, &copied);
+                auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+                if (err != SAHNE_SUCCESS) {
+                    std::cerr << "copy_range failed at " << size << " bytes, error: " << err << std::endl;
+                    break;
+                }
+                std::cout << "copy_range " << copied << " bytes in " << elapsed_us << "us ("
+                          << (elapsed_us > 0 ? static_cast<double>(copied) / static_cast<double>(elapsed_us) : 0.0) << " MB/s)" << std::endl;
+                if (copied < size) {
+                    break; // Kaynak daha küçük
+                }
+            }
+        } else {
+            std::cerr << "\nSkipping copy_range example, error: " << err << std::endl;
+        }
+        if (copy_src != 0) sahne_resource_release(copy_src);
+        if (copy_dst != 0) sahne_resource_release(copy_dst);
+    }
+
+
+    // --- Yeni Özellik: Grup Commit ile Kalıcı Yazma (C++) ---
+    {
+        sahne_handle_t wal_handle = 0;
+        std::string wal_name = "sahne://tmp/example.wal";
+        err = sahne_resource_acquire(reinterpret_cast<const uint8_t*>(wal_name.c_str()), wal_name.length(),
+                                     SAHNE_MODE_WRITE | SAHNE_MODE_CREATE | SAHNE_MODE_TRUNCATE, &wal_handle);
+        if (err == SAHNE_SUCCESS) {
+            // Eşzamanlılık seviyelerine göre commit/sn ve ortalama commit gecikmesi: grup commit ve yazma başına sync
+            const int records_per_thread = 200;
+            for (int threads : {1, 4, 16, 64}) {
+                for (bool grouped : {false, true}) {
+                    sahne::resource::GroupCommitLog wal(wal_handle, SAHNE_SYNC_DATA);
+                    std::mutex per_write_mutex; // Yazma başına sync: kayıtlar sırayla yazılıp tek tek sync edilir
+                    std::atomic<int64_t> latency_us{0};
+                    std::atomic<int> failures{0};
+                    auto start = std::chrono::steady_clock::now();
+                    std::vector<std::thread> writers;
+                    for (int t = 0; t < threads; ++t) {
+                        writers.emplace_back([&, t] {
+                            uint8_t record[64] = {static_cast<uint8_t>(t)};
+                            for (int i = 0; i < records_per_thread; ++i) {
+                                auto begin = std::chrono::steady_clock::now();
+                                sahne_error_t commit_err;
+                                if (grouped) {
+                                    commit_err = wal.append(record, sizeof(record));
+                                } else {
+                                    std::lock_guard<std::mutex> lock(per_write_mutex);
+                                    size_t written = 0;
+                                    commit_err = sahne_resource_write(wal_handle, record, sizeof(record), &written);
+                                    if (commit_err == SAHNE_SUCCESS) {
+                                        commit_err = sahne_resource_sync(wal_handle, SAHNE_SYNC_DATA);
+                                    }
+                                }
+                                if (commit_err != SAHNE_SUCCESS) {
+                                    ++failures;
+                                    return;
+                                }
+                                latency_us += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+                            }
+                        });
+                    }
+                    for (auto& writer : writers) {
+                        writer.join();
+                    }
+                    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    int commits = threads * records_per_thread;
+                    if (failures != 0) {
+                        std::cerr << "WAL commit failed (" << (grouped ? "group" : "per-write") << " sync)" << std::endl;
+                        break;
+                    }
+                    std::cout << (grouped ? "group commit  " : "per-write sync") << " threads=" << threads
+                              << ": " << (seconds > 0 ? commits / seconds : 0.0) << " commits/s, avg latency "
+                              << latency_us.load() / commits << "us"
+                              << (grouped ? ", syncs=" + std::to_string(wal.sync_count()) : std::string()) << std::endl;
+                }
+            }
+            sahne_resource_release(wal_handle);
+        } else {
+            std::cerr << "\nSkipping group commit example, error: " << err << std::endl;
+        }
+    }
+
+
+    // --- Yeni Özellik: Erişim Deseni Tavsiyesi ve Önden Getirme (C++) ---
+    {
+        // Soğuk sıralı tarama: tavsiyesiz düz okuma ve SEQUENTIAL + önden getirme (scan_sequential)
+        sahne_handle_t scan_handle = 0;
+        std::string scan_name = "sahne://tmp/copy_src";
+        err = sahne_resource_acquire(reinterpret_cast<const uint8_t*>(scan_name.c_str()), scan_name.length(), SAHNE_MODE_READ, &scan_handle);
+        if (err == SAHNE_SUCCESS) {
+            std::vector<uint8_t> buffer(256 * 1024);
+            for (bool advised : {false, true}) {
+                uint64_t pos = 0;
+                // Her turdan önce sayfa önbelleğini boşalt ki tarama soğuk başlasın
+                sahne_resource_advise(scan_handle, 0, SAHNE_ADVISE_TO_END, SAHNE_ADVICE_DONTNEED);
+                sahne_resource_advise(scan_handle, 0, SAHNE_ADVISE_TO_END, SAHNE_ADVICE_NORMAL);
+                err = sahne_resource_seek(scan_handle, SAHNE_SEEK_SET, 0, &pos);
+                uint64_t total = 0;
+                uint8_t sink = 0;
+                auto start = std::chrono::steady_clock::now();
+                if (err == SAHNE_SUCCESS && advised) {
+                    err = sahne::resource::scan_sequential(scan_handle, buffer, uint64_t{4} << 20, [&](const uint8_t* data, size_t len) {
+                        sink ^= data[len - 1];
+                        total += len;
+                        return true;
+                    });
+                } else {
+                    size_t n = 0;
+                    while (err == SAHNE_SUCCESS && (err = sahne_resource_read(scan_handle, buffer.data(), buffer.size(), &n)) == SAHNE_SUCCESS && n != 0) {
+                        sink ^= buffer[n - 1];
+                        total += n;
+                    }
+                }
+                double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+                if (err != SAHNE_SUCCESS) {
+                    std::cerr << "Sequential scan failed, error: " << err << std::endl;
+                    break;
+                }
+                std::cout << (advised ? "advised scan  " : "unadvised scan") << ": " << total << " bytes, "
+                          << (us > 0 ? static_cast<double>(total) / us : 0.0) << " MB/s (checksum " << static_cast<int>(sink) << ")" << std::endl;
+            }
+            sahne_resource_release(scan_handle);
+        } else {
+            std::cerr << "\nSkipping sequential scan example, error: " << err << std::endl;
+        }
+
+        // Paylaşımlı eşlenmiş tabloda rastgele arama: tavsiyesiz ve RANDOM + WILLNEED (+ HUGEPAGE)
+        const size_t table_bytes = size_t{256} << 20;
+        const int lookups = 2000000;
+        for (uint32_t mode = 0; mode < 3; ++mode) {
+            sahne::memory::SharedBuffer table;
+            err = table.create(table_bytes);
+            if (err != SAHNE_SUCCESS) {
+                std::cerr << "\nSkipping random lookup example, error: " << err << std::endl;
+                break;
+            }
+            if (mode >= 1) {
+                table.advise(SAHNE_ADVICE_RANDOM);
+                table.advise(SAHNE_ADVICE_WILLNEED);
+            }
+            if (mode == 2 && table.advise(SAHNE_ADVICE_HUGEPAGE) != SAHNE_SUCCESS) {
+                std::cout << "HUGEPAGE advice not supported for this mapping" << std::endl;
+                break;
+            }
+            const uint64_t* slots = reinterpret_cast<const uint64_t*>(table.data());
+            const size_t slot_count = table.size() / sizeof(uint64_t);
+            uint64_t x = 0x9E3779B97F4A7C15ull;
+            uint64_t sum = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < lookups; ++i) {
+                x ^= x << 13; x ^= x >> 7; x ^= x << 17; // xorshift64
+                sum += slots[x % slot_count];
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            const char* labels[] = {"no advice        ", "RANDOM+WILLNEED  ", "+HUGEPAGE        "};
+            std::cout << "random lookups, " << labels[mode] << ": " << (seconds > 0 ? lookups / seconds : 0.0)
+                      << " ops/s (sum " << sum << ")" << std::endl;
+        }
+    }
+
+
+    // --- Yeni Özellik: Parçalanmış Metrikler ve sahne://metrics Kaynağı (C++) ---
+    {
+        // Artış maliyeti: iş parçacığı başına parçalanmış sayaç ve tek paylaşımlı atomik (1..N iş parçacığı)
+        const int increments = 5000000;
+        const unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+            for (bool sharded : {false, true}) {
+                std::atomic<uint64_t> shared_counter{0};
+                sahne::metrics::Counter sharded_counter;
+                auto start = std::chrono::steady_clock::now();
+                std::vector<std::thread> workers;
+                for (unsigned t = 0; t < threads; ++t) {
+                    workers.emplace_back([&] {
+                        for (int i = 0; i < increments; ++i) {
+                            if (sharded) {
+                                sharded_counter.inc();
+                            } else {
+                                shared_counter.fetch_add(1, std::memory_order_relaxed);
+                            }
+                        }
+                    });
+                }
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+                double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / increments;
+                std::cout << (sharded ? "sharded counter" : "shared atomic  ") << " threads=" << threads
+                          << ": " << ns << " ns/increment (per thread)" << std::endl;
+            }
+        }
+
+        // Metrikleri sahne://metrics/<görev id> olarak yayınla ve kendimiz okuyalım
+        sahne::metrics::Registry registry;
+        registry.counter("example_requests_total")->add(3);
+        registry.gauge("example_queue_depth")->set(7);
+        sahne::metrics::Histogram* latency = registry.histogram("example_latency_us", {10, 100, 1000, 10000});
+        for (uint64_t v : {5u, 50u, 500u, 5000u, 50000u}) {
+            latency->observe(v);
+        }
+        sahne::metrics::Exporter exporter(registry);
+        err = exporter.start();
+        if (err == SAHNE_SUCCESS) {
+            std::vector<uint8_t> binary;
+            std::vector<uint8_t> text;
+            err = sahne::metrics::fetch(exporter.name(), binary);
+            if (err == SAHNE_SUCCESS) {
+                err = sahne::metrics::fetch(exporter.name() + SAHNE_METRICS_TEXT_PATH, text);
+            }
+            if (err == SAHNE_SUCCESS) {
+                std::cout << "\n" << exporter.name() << ": " << binary.size() << " byte binary snapshot, text:\n"
+                          << std::string(text.begin(), text.end());
+            } else {
+                std::cerr << "\nFailed to read " << exporter.name() << ", error: " << err << std::endl;
+            }
+            exporter.stop();
+        } else {
+            std::cerr << "\nSkipping metrics export example, error: " << err << std::endl;
+        }
+    }
+
+
+    // --- Yeni Özellik: Paylaşımlı Bellek Üzerinde Yayın Kanalı (C++) ---
+    {
+        // Abone sayısına göre yayılım (fan-out): yayın halkası ve abone başına sahne_channel_send
+        // Her mesaj gönderim anını (steady_clock ns) taşır; ortalama gecikme alıcı tarafında ölçülür.
+        // Kanal sürümü kuyrukları taşırmamak için 64'lük turlarla gönderir; okuyucular gönderim uçları
+        // bırakılınca DISCONNECTED ile çıkar (bant içi bitiş işareti kullanılmaz).
+        const int messages = 20000;
+        const int burst = 64;
+        for (int subscribers : {1, 4, 16, 64}) {
+            for (bool use_broadcast : {false, true}) {
+                err = SAHNE_SUCCESS;
+                sahne::broadcast::Sender bcast;
+                std::vector<sahne_handle_t> send_ends(subscribers, 0), recv_ends(subscribers, 0);
+                if (use_broadcast) {
+                    err = bcast.create(1024, 64);
+                } else {
+                    for (int s = 0; s < subscribers && err == SAHNE_SUCCESS; ++s) {
+                        err = sahne_channel_create_pair(&send_ends[s], &recv_ends[s]);
+                    }
+                }
+                if (err != SAHNE_SUCCESS) {
+                    std::cerr << "\nSkipping fan-out example, error: " << err << std::endl;
+                    break;
+                }
+                std::atomic<int64_t> latency_ns{0};
+                std::atomic<uint64_t> delivered{0};
+                std::atomic<uint64_t> lagged{0};
+                std::atomic<int> readers_done{0};
+                std::vector<std::thread> readers;
+                std::vector<sahne::broadcast::Receiver> receivers(use_broadcast ? subscribers : 0);
+                for (auto& receiver : receivers) {
+                    receiver.attach(bcast.handle());
+                }
+                auto start = std::chrono::steady_clock::now();
+                for (int s = 0; s < subscribers; ++s) {
+                    readers.emplace_back([&, s] {
+                        uint8_t msg[64];
+                        size_t len = 0;
+                        for (;;) {
+                            sahne_error_t rerr = use_broadcast
+                                ? receivers[s].receive(msg, sizeof(msg), &len)
+                                : sahne_channel_receive(recv_ends[s], msg, sizeof(msg), &len);
+                            if (rerr == SAHNE_ERROR_LAGGED) {
+                                continue;
+                            }
+                            if (rerr != SAHNE_SUCCESS || len < sizeof(int64_t)) {
+                                break; // Yayın kapandı (DISCONNECTED) veya kanal kapandı
+                            }
+                            int64_t sent_at = 0;
+                            std::memcpy(&sent_at, msg, sizeof(sent_at));
+                            latency_ns += std::chrono::steady_clock::now().time_since_epoch().count() - sent_at;
+                            ++delivered;
+                        }
+                        if (use_broadcast) {
+                            lagged += receivers[s].missed();
+                        }
+                        ++readers_done;
+                    });
+                }
+                uint8_t msg[64] = {};
+                uint64_t sent = 0;
+                sahne_error_t send_err = SAHNE_SUCCESS;
+                for (int i = 0; i < messages && send_err == SAHNE_SUCCESS; ++i) {
+                    int64_t sent_at = static_cast<int64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+                    std::memcpy(msg, &sent_at, sizeof(sent_at));
+                    if (use_broadcast) {
+                        send_err = bcast.send(msg, sizeof(msg));
+                        continue;
+                    }
+                    for (int s = 0; s < subscribers && send_err == SAHNE_SUCCESS; ++s) {
+                        send_err = sahne_channel_send(send_ends[s], msg, sizeof(msg));
+                        sent += send_err == SAHNE_SUCCESS;
+                    }
+                    if ((i + 1) % burst == 0) {
+                        // Tur bitti: okuyucular yetişene kadar bekle (biri erken çıktıysa beklemeyi bırak)
+                        while (delivered.load() < sent && readers_done.load() == 0) {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+                if (send_err != SAHNE_SUCCESS) {
+                    std::cerr << "Fan-out send failed, error: " << send_err << std::endl;
+                }
+                bcast.close();
+                for (int s = 0; s < subscribers; ++s) {
+                    if (send_ends[s] != 0) {
+                        sahne_resource_release(send_ends[s]); // Okuyucu DISCONNECTED ile çıkar
+                        send_ends[s] = 0;
+                    }
+                }
+                for (auto& reader : readers) {
+                    reader.join();
+                }
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                std::cout << (use_broadcast ? "broadcast ring  " : "per-sub channels") << " subscribers=" << subscribers
+                          << ": " << (seconds > 0 ? delivered.load() / seconds : 0.0) << " deliveries/s, avg latency "
+                          << (delivered.load() != 0 ? latency_ns.load() / static_cast<int64_t>(delivered.load()) : 0) << "ns"
+                          << (use_broadcast ? ", lagged=" + std::to_string(lagged.load()) : std::string()) << std::endl;
+                receivers.clear();
+                for (int s = 0; s < subscribers; ++s) {
+                    if (send_ends[s] != 0) sahne_resource_release(send_ends[s]);
+                    if (recv_ends[s] != 0) sahne_resource_release(recv_ends[s]);
+                }
+            }
+        }
+    }
+
+
+    // --- Yeni Özellik: SIMD Sağlama Toplamları (C++) ---
+    {
+        // Mevcut her CRC32C çekirdeği ve xxHash64 için GB/s (64 MiB tampon, 4 tekrar)
+        std::vector<uint8_t> payload(64u << 20);
+        for (size_t i = 0; i < payload.size(); ++i) {
+            payload[i] = static_cast<uint8_t>(i * 31u + (i >> 11));
+        }
+        auto gbps = [&payload](double seconds) { return seconds > 0 ? 4.0 * payload.size() / seconds / 1e9 : 0.0; };
+        const uint32_t kernels = sahne_checksum_kernels();
+        const char* kernel_names[] = {"scalar", "sse4.2", "arm-crc"};
+        std::cout << "\nActive CRC32C kernel: " << kernel_names[sahne_checksum_active_kernel()] << std::endl;
+        for (uint32_t kernel = SAHNE_CHECKSUM_KERNEL_SCALAR; kernel <= SAHNE_CHECKSUM_KERNEL_ARM_CRC; ++kernel) {
+            if ((kernels & (1u << kernel)) == 0) {
+                continue;
+            }
+            uint32_t crc = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (int rep = 0; rep < 4; ++rep) {
+                sahne_crc32c_with_kernel(kernel, crc, payload.data(), payload.size(), &crc);
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "crc32c/" << kernel_names[kernel] << ": " << gbps(seconds) << " GB/s (0x" << std::hex << crc << std::dec << ")" << std::endl;
+        }
+        uint64_t hash = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < 4; ++rep) {
+            hash = sahne::checksum::xxhash64(payload.data(), payload.size(), hash);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "xxhash64: " << gbps(seconds) << " GB/s (0x" << std::hex << hash << std::dec << ")" << std::endl;
+
+        // Sağlama toplamlı yazma + doğrulamalı okuma
+        sahne_handle_t data_handle = 0;
+        sahne_handle_t sidecar_handle = 0;
+        std::string data_name = "sahne://tmp/example.dat";
+        std::string sidecar_name = "sahne://tmp/example.dat.crc";
+        const uint32_t rw_mode = SAHNE_MODE_READ | SAHNE_MODE_WRITE | SAHNE_MODE_CREATE | SAHNE_MODE_TRUNCATE;
+        err = sahne_resource_acquire(reinterpret_cast<const uint8_t*>(data_name.c_str()), data_name.length(), rw_mode, &data_handle);
+        if (err == SAHNE_SUCCESS) {
+            err = sahne_resource_acquire(reinterpret_cast<const uint8_t*>(sidecar_name.c_str()), sidecar_name.length(), rw_mode, &sidecar_handle);
+        }
+        if (err == SAHNE_SUCCESS) {
+            sahne::checksum::ChecksumWriter writer(data_handle, sidecar_handle, SAHNE_CHECKSUM_CRC32C, 64 * 1024);
+            err = writer.open();
+            if (err == SAHNE_SUCCESS) err = writer.write(payload.data(), 1u << 20);
+            if (err == SAHNE_SUCCESS) err = writer.finish();
+            sahne::checksum::ChecksumReader reader(data_handle, sidecar_handle);
+            if (err == SAHNE_SUCCESS) err = reader.open();
+            std::vector<uint8_t> block;
+            for (uint64_t index = 0; err == SAHNE_SUCCESS && index < writer.blocks_written(); ++index) {
+                err = reader.read_block(index, block);
+            }
+            if (err == SAHNE_SUCCESS) {
+                std::cout << "Verified " << writer.blocks_written() << " checksummed blocks." << std::endl;
+            } else {
+                std::cerr << "Checksummed write/verify failed, error: " << err << std::endl;
+            }
+        } else {
+            std::cerr << "Skipping checksummed write example, error: " << err << std::endl;
+        }
+        if (data_handle != 0) sahne_resource_release(data_handle);
+        if (sidecar_handle != 0) sahne_resource_release(sidecar_handle);
+    }
+
+
+    // --- Yeni Özellik: Dizin Listeleme ve Paralel Ağaç Gezinme (C++) ---
+    {
+        // Başlangıç taraması: girdi başına acquire/stat/release yerine dizin başına toplu listeleme
+        std::atomic<uint64_t> cache_bytes{0};
+        auto visitor = [&cache_bytes](const std::string&, const sahne::resource::DirEntryView& entry) {
+            if (!entry.is_directory()) {
+                cache_bytes.fetch_add(entry.entry.status.size, std::memory_order_relaxed);
+            }
+        };
+        for (size_t threads : {size_t{1}, size_t{0}}) { // 1 iş parçacığı ve donanım iş parçacığı sayısı
+            sahne::resource::TreeWalkOptions walk_options;
+            walk_options.threads = threads;
+            uint64_t entries = 0;
+            cache_bytes = 0;
+            auto start = std::chrono::steady_clock::now();
+            err = sahne::resource::TreeWalker::walk("sahne://cache", visitor, walk_options, &entries);
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            if (err == SAHNE_SUCCESS) {
+                std::cout << "\nScanned sahne://cache (" << (threads == 0 ? "all" : "1") << " thread(s)): " << entries
+                          << " entries, " << cache_bytes.load() << " bytes in " << elapsed << "ms" << std::endl;
+            } else {
+                std::cerr << "\nFailed to scan sahne://cache, error: " << err << std::endl;
+                break;
+            }
+        }
+    }
+
+
     // --- Yeni Özellik: Polling (C++) ---
     sahne_handle_t console_read_handle = 0;
     sahne_handle_t dummy_event_handle = 0;
@@ -38,6 +38,9 @@ typedef int32_t sahne_error_t; // Hata kodları için (negatif veya pozitif olab
 #define SAHNE_ERROR_COMMUNICATION_ERROR 16
 #define SAHNE_ERROR_WOULD_BLOCK 17 // Yeni hata türü
 #define SAHNE_ERROR_DISCONNECTED 18 // Yeni hata türü
+#define SAHNE_ERROR_TIMED_OUT 19 // İşlem son tarihi (deadline) geçti
+#define SAHNE_ERROR_CHECKSUM_MISMATCH 20 // Veri bütünlüğü doğrulaması başarısız (sağlama toplamı uyuşmuyor)
+#define SAHNE_ERROR_LAGGED 21 // Okuyucu geride kaldı, mesajların üzerine yazıldı (yayın kanalı)
 // ... sahne64.rs'deki SahneError enumundaki diğer hata kodları buraya eklenmeli ...
 
 // --- Sistem Çağrı Numaraları (sahne64.rs arch modülünden) ---
@@ -75,6 +78,31 @@ typedef int32_t sahne_error_t; // Hata kodları için (negatif veya pozitif olab
 #define SAHNE_SYSCALL_CHANNEL_SEND 108
 #define SAHNE_SYSCALL_CHANNEL_RECEIVE 109
 #define SAHNE_SYSCALL_POLL          110
+#define SAHNE_SYSCALL_CHANNEL_SEND_MANY    111
+#define SAHNE_SYSCALL_CHANNEL_RECEIVE_MANY 112
+#define SAHNE_SYSCALL_CHANNEL_SEND_HANDLES    113
+#define SAHNE_SYSCALL_CHANNEL_RECEIVE_HANDLES 114
+#define SAHNE_SYSCALL_TASK_GET_INITIAL_HANDLES 115
+#define SAHNE_SYSCALL_TASK_TEMPLATE_CREATE     116
+#define SAHNE_SYSCALL_TASK_TEMPLATE_CHECKPOINT 117
+#define SAHNE_SYSCALL_TASK_SPAWN_FROM_TEMPLATE 118
+#define SAHNE_SYSCALL_CHANNEL_CREATE_PAIR      119
+#define SAHNE_SYSCALL_TASK_OPEN                120
+#define SAHNE_SYSCALL_TASK_WAIT_MANY           121
+#define SAHNE_SYSCALL_TIMER_CREATE             122
+#define SAHNE_SYSCALL_TIMER_SET                123
+#define SAHNE_SYSCALL_TASK_SLEEP_NS            124
+#define SAHNE_SYSCALL_POLL_NS                  125
+#define SAHNE_SYSCALL_KERNEL_GET_STATS         126
+#define SAHNE_SYSCALL_MEM_PRESSURE_OPEN        127
+#define SAHNE_SYSCALL_RESOURCE_ENUMERATE       128
+#define SAHNE_SYSCALL_RESOURCE_COPY_RANGE      129
+#define SAHNE_SYSCALL_RESOURCE_SYNC            130
+#define SAHNE_SYSCALL_SHARED_MEM_NOTIFY        131
+#define SAHNE_SYSCALL_SHARED_MEM_WATCH         132
+#define SAHNE_SYSCALL_RESOURCE_PUBLISH         133
+#define SAHNE_SYSCALL_RESOURCE_ADVISE          134
+#define SAHNE_SYSCALL_MEM_ADVISE               135
 
 
 // --- Kaynak Modları (sahne64.rs resource modülünden) ---
@@ -94,6 +122,24 @@ typedef int32_t sahne_error_t; // Hata kodları için (negatif veya pozitif olab
 #define SAHNE_KERNEL_INFO_ARCHITECTURE 5
 #define SAHNE_KERNEL_INFO_TOTAL_MEMORY_BYTES 6 // Yeni info türü
 #define SAHNE_KERNEL_INFO_FREE_MEMORY_BYTES 7  // Yeni info türü
+#define SAHNE_KERNEL_INFO_CPU_FEATURES 8       // SAHNE_CPU_FEATURE_* bit maskesi
+
+// SAHNE_KERNEL_INFO_CPU_FEATURES bitleri (kullanıcı alanının güvenle kullanabileceği işlemci özellikleri)
+#define SAHNE_CPU_FEATURE_SSE42     (1 << 0)
+#define SAHNE_CPU_FEATURE_PCLMULQDQ (1 << 1)
+#define SAHNE_CPU_FEATURE_AVX2      (1 << 2)
+#define SAHNE_CPU_FEATURE_AVX512F   (1 << 3)
+#define SAHNE_CPU_FEATURE_NEON      (1 << 4)
+#define SAHNE_CPU_FEATURE_ARM_CRC32 (1 << 5)
+
+// sahne_kernel_get_stats yapı sürümü
+#define SAHNE_KERNEL_STATS_VERSION 1
+
+// Bellek baskısı seviyeleri (sahne_mem_pressure_open, KernelStats_t.memory_pressure)
+#define SAHNE_MEM_PRESSURE_NONE     0 // Normal
+#define SAHNE_MEM_PRESSURE_LOW      1 // Boş bellek azalıyor: önbellekler küçülmeye başlamalı
+#define SAHNE_MEM_PRESSURE_MEDIUM   2 // Çekirdek geri kazanım yapıyor: gereksiz bellek bırakılmalı
+#define SAHNE_MEM_PRESSURE_CRITICAL 3 // SAHNE_ERROR_OUT_OF_MEMORY yakın: bırakılabilecek her şey bırakılmalı
 
 
 // --- Yeni Eklenen Yapılar ve Enum Karşılıkları ---
@@ -103,6 +149,24 @@ typedef int32_t sahne_error_t; // Hata kodları için (negatif veya pozitif olab
 #define SAHNE_SEEK_CUR 1 // Mevcut konumdan (Current)
 #define SAHNE_SEEK_END 2 // Sondan (End)
 
+// sahne_resource_copy_range ofseti: handle'ın mevcut konumu kullanılır ve kopyalanan kadar ilerletilir
+// (kanallar, cihazlar gibi konumlanamayan kaynaklar için zorunludur)
+#define SAHNE_COPY_OFFSET_CURRENT UINT64_MAX
+
+// sahne_resource_sync bayrakları
+#define SAHNE_SYNC_FLUSH    0        // Yazılanları cihaza göndermeyi başlat, kalıcı olmasını bekleme
+#define SAHNE_SYNC_DATA     (1 << 0) // Veri (ve geri okumak için gereken meta veri) kalıcı olana kadar bekle
+#define SAHNE_SYNC_METADATA (1 << 1) // SAHNE_SYNC_DATA'ya ek olarak tüm meta veriyi (boyut, zamanlar) kalıcı yap
+
+// sahne_resource_advise / sahne_mem_advise erişim tavsiyeleri (bir aralık için son verilen geçerlidir)
+#define SAHNE_ADVICE_NORMAL     0 // Varsayılan okuma önden getirme (read-ahead) ve tahliye davranışı
+#define SAHNE_ADVICE_SEQUENTIAL 1 // Sıralı erişim: agresif read-ahead, okunan sayfalar erken tahliye edilebilir
+#define SAHNE_ADVICE_RANDOM     2 // Rastgele erişim: read-ahead kapalı
+#define SAHNE_ADVICE_WILLNEED   3 // Yakında erişilecek: arka planda belleğe getir (beklemez)
+#define SAHNE_ADVICE_DONTNEED   4 // Bir süre erişilmeyecek: önce bu sayfalar tahliye edilsin
+#define SAHNE_ADVICE_HUGEPAGE   5 // Eşlenmiş aralık büyük sayfalarla desteklensin (yalnızca sahne_mem_advise)
+#define SAHNE_ADVISE_TO_END     0 // len için "ofsetten kaynağın sonuna kadar"
+
 // resource::ResourceStatus struct'ının C karşılığı (repr(C) uyumlu)
 typedef struct ResourceStatus_t {
     uint64_t size;       // Kaynak boyutu
@@ -112,6 +176,145 @@ typedef struct ResourceStatus_t {
     // TODO: Diğer alanlar (sahne64.rs'deki ResourceStatus ile senkron tutulmalı)
 } ResourceStatus_t;
 
+// ResourceStatus_t.type_flags içindeki kaynak tipi (alt 8 bit)
+#define SAHNE_RESOURCE_TYPE_MASK      0xFF
+#define SAHNE_RESOURCE_TYPE_FILE      1
+#define SAHNE_RESOURCE_TYPE_DIRECTORY 2 // sahne_resource_enumerate ile listelenebilir isim alanı
+#define SAHNE_RESOURCE_TYPE_DEVICE    3
+
+// sahne_resource_enumerate kayıt formatı. Tampon içinde kayıtlar arka arkaya dizilir:
+// [DirEntry_t][isim (name_len byte, NUL ile bitmez)][dolgu]; sonraki kayıt record_len byte sonra başlar
+// (record_len SAHNE_DIR_ENTRY_ALIGN'ın katıdır).
+typedef struct DirEntry_t {
+    uint32_t record_len;     // Bu kaydın isim ve dolgu dahil toplam uzunluğu
+    uint16_t name_len;       // İsmin byte uzunluğu
+    uint16_t reserved;
+    uint64_t cookie;         // Bu kayıttan sonrasına devam etmek için çerez
+    ResourceStatus_t status; // sahne_resource_stat ile aynı bilgiler (ayrı acquire/stat/release gerekmez)
+} DirEntry_t;
+
+#define SAHNE_DIR_ENTRY_ALIGN 8
+#define SAHNE_DIR_ENTRY_NAME(entry) ((const char*)(entry) + sizeof(DirEntry_t))
+#define SAHNE_ENUM_COOKIE_START 0 // İlk çağrıda *inout_cookie değeri
+
+// messaging:: toplu (batch) gönderim/alım çerçeve formatı
+// Her mesaj tampon içinde [uint32_t uzunluk][veri][hizalama dolgusu] şeklinde dizilir.
+// Bir sonraki çerçeve SAHNE_CHANNEL_FRAME_ALIGN sınırından başlar.
+#define SAHNE_CHANNEL_FRAME_HEADER_SIZE 4
+#define SAHNE_CHANNEL_FRAME_ALIGN       8
+#define SAHNE_CHANNEL_FRAME_SIZE(len) \
+    (((size_t)SAHNE_CHANNEL_FRAME_HEADER_SIZE + (size_t)(len) + (SAHNE_CHANNEL_FRAME_ALIGN - 1)) & ~(size_t)(SAHNE_CHANNEL_FRAME_ALIGN - 1))
+
+// messaging::MessageSpan struct'ının C karşılığı (repr(C) uyumlu)
+// sahne_channel_receive_many tarafından her alınan mesaj için doldurulur.
+typedef struct MessageSpan_t {
+    uint32_t offset; // Mesaj verisinin tampon başından ofseti (çerçeve başlığından sonrası)
+    uint32_t len;    // Mesaj verisinin uzunluğu
+} MessageSpan_t;
+
+// Tek bir mesaja eklenebilecek en fazla handle sayısı
+#define SAHNE_CHANNEL_MAX_HANDLES 64
+
+// messaging::Envelope struct'ının C karşılığı (repr(C) uyumlu)
+// Handle'lı mesaj alımında çekirdeğe geçirilir; *_len alanlarını çekirdek doldurur.
+typedef struct ChannelEnvelope_t {
+    uint8_t* data;           // Mesaj verisinin kopyalanacağı tampon
+    size_t data_cap;         // Tamponun boyutu
+    size_t data_len;         // Alınan byte sayısı (output)
+    sahne_handle_t* handles; // Aktarılan handle'ların yazılacağı dizi
+    size_t handles_cap;      // Dizinin kapasitesi
+    size_t handles_len;      // Alınan handle sayısı (output)
+} ChannelEnvelope_t;
+
+// rpc:: ikili çerçeve formatı (sahne_rpc.hpp ve sahne64.rs rpc modülü ile ortak)
+// Her RPC mesajı tek bir kanal mesajıdır: [SahneRpcHeader_t][payload_len byte veri].
+#define SAHNE_RPC_VERSION        1
+#define SAHNE_RPC_KIND_REQUEST   1 // İstemci -> sunucu
+#define SAHNE_RPC_KIND_RESPONSE  2 // Sunucu -> istemci (status alanı sonucu taşır)
+#define SAHNE_RPC_KIND_CANCEL    3 // İstemci -> sunucu, bekleyen isteği iptal et
+#define SAHNE_RPC_NO_DEADLINE    0 // deadline_ns için "süre sınırı yok"
+
+typedef struct SahneRpcHeader_t {
+    uint16_t version;     // SAHNE_RPC_VERSION
+    uint16_t kind;        // SAHNE_RPC_KIND_*
+    uint32_t method;      // Uygulamaya özel metod numarası
+    uint64_t request_id;  // İstemcinin atadığı korelasyon ID'si (kanal başına benzersiz)
+    uint64_t deadline_ns; // Mutlak son tarih (sahne_kernel_get_time saatine göre), 0 = yok
+    int32_t  status;      // Yanıtta SAHNE_SUCCESS veya SAHNE_ERROR_*; istekte 0
+    uint32_t payload_len; // Başlıktan sonra gelen veri uzunluğu
+} SahneRpcHeader_t;
+
+// sahne_resource_publish ile yayınlanan kaynaklara çekirdeğin ilettiği istekler (rpc:: çerçevesi, SahneRpcHeader_t.method)
+#define SAHNE_RESOURCE_METHOD_READ 1 // Veri: SahneResourceReadRequest_t + path_len byte alt yol
+
+typedef struct SahneResourceReadRequest_t {
+    uint64_t offset;   // Okuma ofseti (okuyucu handle'ının konumu)
+    uint32_t max_len;  // Okuyucu tamponunun boyutu; yanıt bundan uzun olamaz
+    uint32_t path_len; // Yayınlanan addan sonraki alt yol uzunluğu (örn. "/text" için 5, yoksa 0)
+} SahneResourceReadRequest_t;
+
+// metrics:: ikili anlık görüntü formatı (sahne_metrics.hpp; sahne://metrics/<görev> okumaları)
+// [SahneMetricsHeader_t][metric_count adet kayıt]; her kayıt [SahneMetricRecord_t][isim, 8'e dolgulu][değerler]:
+//   SAHNE_METRIC_COUNTER   -> uint64_t değer
+//   SAHNE_METRIC_GAUGE     -> int64_t değer
+//   SAHNE_METRIC_HISTOGRAM -> uint64_t count, uint64_t sum, ardından bucket_count adet
+//                             (uint64_t üst sınır (dahil), uint64_t sayı); son kovanın üst sınırı UINT64_MAX
+// Aynı kaynak "<ad>" + SAHNE_METRICS_TEXT_PATH ile okunduğunda satır tabanlı metin formatı döner.
+#define SAHNE_METRICS_MAGIC     0x5254454D // "METR"
+#define SAHNE_METRICS_VERSION   1
+#define SAHNE_METRICS_PREFIX    "sahne://metrics/"
+#define SAHNE_METRICS_TEXT_PATH "/text"
+#define SAHNE_METRIC_COUNTER    1
+#define SAHNE_METRIC_GAUGE      2
+#define SAHNE_METRIC_HISTOGRAM  3
+
+typedef struct SahneMetricsHeader_t {
+    uint32_t magic;        // SAHNE_METRICS_MAGIC
+    uint16_t version;      // SAHNE_METRICS_VERSION
+    uint16_t reserved;
+    uint32_t metric_count; // Kayıt sayısı
+    uint32_t total_len;    // Başlık dahil toplam byte
+    uint64_t timestamp_ns; // Anlık görüntünün alındığı an (sahne_kernel_get_time saati)
+} SahneMetricsHeader_t;
+
+typedef struct SahneMetricRecord_t {
+    uint16_t kind;         // SAHNE_METRIC_*
+    uint16_t name_len;     // İsim uzunluğu (dolgu hariç)
+    uint32_t bucket_count; // Yalnızca histogramlar için, diğerlerinde 0
+} SahneMetricRecord_t;
+
+// broadcast:: yayın kanalı paylaşımlı bellek düzeni (sahne_broadcast.hpp ve sahne64.rs broadcast modülü ile ortak)
+// Tek yazıcı, çok okuyucu: [SahneBroadcastHeader_t][slot_count adet slot_size byte'lık yuva].
+// Her yuva [SahneBroadcastSlot_t][veri] şeklindedir; n. mesaj (n & (slot_count - 1)) numaralı yuvaya yazılır.
+// Okuyucular kendi imleçlerini (cursor) yerel olarak tutar; yazıcı asla okuyucuları beklemez.
+// Üzerine yazılmış bir mesajı okumaya çalışan okuyucu SAHNE_ERROR_LAGGED alır.
+#define SAHNE_BROADCAST_MAGIC      0x54534342 // "BCST"
+#define SAHNE_BROADCAST_VERSION    1
+#define SAHNE_BROADCAST_SLOT_ALIGN 64         // Yuva boyutu bu değerin katıdır (önbellek satırı)
+
+typedef struct SahneBroadcastHeader_t {
+    uint32_t magic;       // SAHNE_BROADCAST_MAGIC
+    uint16_t version;     // SAHNE_BROADCAST_VERSION
+    uint16_t reserved;
+    uint32_t slot_count;  // Yuva sayısı (2'nin kuvveti, >= 2)
+    uint32_t slot_size;   // Yuva başlığı dahil yuva boyutu (SAHNE_BROADCAST_SLOT_ALIGN katı)
+    uint8_t  pad0[48];
+    uint64_t write_seq;   // Yayınlanan mesaj sayısı (yalnızca yazıcı artırır, atomik erişilir)
+    uint8_t  pad1[56];
+    uint32_t waiters;     // Bildirim için park etmiş okuyucu sayısı (atomik erişilir)
+    uint32_t closed;      // Yazıcı kanalı kapattıysa 1 (atomik erişilir)
+    uint8_t  pad2[56];
+} SahneBroadcastHeader_t;
+
+typedef struct SahneBroadcastSlot_t {
+    uint64_t seq;      // 2n+1: n. mesaj yazılıyor, 2n+2: n. mesaj hazır (atomik erişilir)
+    uint32_t len;      // Mesaj uzunluğu
+    uint32_t reserved;
+} SahneBroadcastSlot_t;
+
+#define SAHNE_BROADCAST_REGION_SIZE(slot_count, slot_size) \
+    (sizeof(SahneBroadcastHeader_t) + (size_t)(slot_count) * (size_t)(slot_size))
+
 // poll::PollEventFlags enum'ının C karşılığı için sabitler
 typedef uint32_t PollEventFlags_t;
 #define SAHNE_POLL_NONE       0
@@ -119,7 +322,24 @@ typedef uint32_t PollEventFlags_t;
 #define SAHNE_POLL_WRITABLE   (1 << 1)
 #define SAHNE_POLL_ERROR      (1 << 2)
 #define SAHNE_POLL_DISCONNECTED (1 << 3)
-// TODO: Diğer PollEventFlags sabitleri
+#define SAHNE_POLL_TASK_EXITED  (1 << 4) // Görev sonlandı (sahne_task_open ile alınan görev handle'ları için)
+// TODO: Diğer PollEventFlags sabitleri (kilit açıldı vb.)
+
+// task::wait_many bayrakları
+#define SAHNE_TASK_WAIT_ANY       0        // En az bir görev sonlanınca dön (o an sonlanmış olanların hepsini topla)
+#define SAHNE_TASK_WAIT_ALL       (1 << 0) // Listedeki tüm görevler sonlanınca dön
+#define SAHNE_TASK_WAIT_CHILDREN  (1 << 1) // Liste yerine çağıranın tüm çocuk görevlerini bekle (task_ids yok sayılır)
+
+// task::TaskExitStatus struct'ının C karşılığı (repr(C) uyumlu)
+typedef struct TaskExitStatus_t {
+    sahne_task_id_t task_id; // Sonlanan görev
+    int32_t exit_code;       // Görevin çıkış kodu
+    uint32_t reserved;       // Hizalanma/gelecekte kullanım
+} TaskExitStatus_t;
+
+// timer:: bayrakları
+#define SAHNE_TIMER_RELATIVE 0        // initial_ns şimdiden itibaren göreli süredir
+#define SAHNE_TIMER_ABSOLUTE (1 << 0) // initial_ns sahne_kernel_get_time saatine göre mutlak zamandır
 
 // poll::PollEntry struct'ının C karşılığı (repr(C) uyumlu)
 typedef struct PollEntry_t {
@@ -178,6 +398,52 @@ sahne_error_t sahne_mem_map_shared(sahne_handle_t handle, size_t offset, size_t
  */
 sahne_error_t sahne_mem_unmap_shared(void* addr, size_t size);
 
+/**
+ * (Yeni) Poll edilebilir bir bellek baskısı handle'ı açar.
+ * Sistem bellek baskısı seviyesi değişip min_level veya üzerine çıktığında (ve tekrar altına indiğinde)
+ * handle SAHNE_POLL_READABLE olur. sahne_resource_read ile 4 byte okunduğunda anlık seviye (uint32_t,
+ * SAHNE_MEM_PRESSURE_*) döner. Böylece önbellekler SAHNE_ERROR_OUT_OF_MEMORY oluşmadan küçültülebilir.
+ * Handle sahne_resource_release ile bırakılır.
+ * @param min_level Bildirim için en düşük seviye (SAHNE_MEM_PRESSURE_LOW..CRITICAL).
+ * @param out_handle Başarı durumunda handle saklamak için çıkış parametresi.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_mem_pressure_open(uint32_t min_level, sahne_handle_t* out_handle);
+
+/**
+ * (Yeni) Paylaşımlı bellek nesnesi için açılmış tüm izleme handle'larını (sahne_mem_watch_shared) uyandırır.
+ * Veri paylaşımlı bellekte taşınır; bu çağrı yalnızca bekleyenlere "yeni veri var" bildirimi yapar.
+ * Kaç izleyici olursa olsun tek bir çağrıdır.
+ * @param handle Paylaşımlı bellek alanının handle'ı.
+ * @param value İzleme handle'larından okunacak değer (örn. son yayınlanan sıra numarası).
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_mem_notify_shared(sahne_handle_t handle, uint64_t value);
+
+/**
+ * (Yeni) Paylaşımlı bellek nesnesi için poll edilebilir bir izleme handle'ı açar.
+ * sahne_mem_notify_shared çağrıldığında handle SAHNE_POLL_READABLE olur; sahne_resource_read ile
+ * 8 byte okunduğunda son bildirilen değer (uint64_t) döner ve hazır durumu temizlenir.
+ * Okumadan önce gelen bildirimler kaybolmaz (tek bir hazır durumunda birleşir).
+ * Handle sahne_resource_release ile bırakılır.
+ * @param handle Paylaşımlı bellek alanının handle'ı.
+ * @param out_watch_handle Başarı durumunda izleme handle'ını saklamak için çıkış parametresi.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_mem_watch_shared(sahne_handle_t handle, sahne_handle_t* out_watch_handle);
+
+/**
+ * (Yeni) Eşlenmiş bir bellek aralığı (sahne_mem_map_shared veya sahne_mem_allocate) için erişim biçimini bildirir.
+ * Örn. rastgele erişilen paylaşımlı tablolar için SAHNE_ADVICE_RANDOM + SAHNE_ADVICE_WILLNEED tahliyeyi azaltır,
+ * SAHNE_ADVICE_HUGEPAGE TLB baskısını düşürür. addr sayfa sınırına hizalı olmalıdır; len çekirdek tarafından
+ * sayfa sınırına yukarı yuvarlanır (eşlemenin kendi boyutu, örn. SharedBuffer::size(), doğrudan verilebilir).
+ * @param addr Aralığın başlangıç adresi.
+ * @param len Aralık uzunluğu (byte; sayfa katı olması gerekmez).
+ * @param advice SAHNE_ADVICE_*.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_mem_advise(void* addr, size_t len, uint32_t advice);
+
 
 // --- Görev Yönetimi ---
 /**
@@ -185,7 +451,7 @@ sahne_error_t sahne_mem_unmap_shared(void* addr, size_t size);
  * @param code_handle Çalıştırılabilir kodu içeren kaynağın handle'ı.
  * @param args_ptr Göreve iletilecek argüman verisine pointer.
  * @param args_len Argüman verisi uzunluğu.
- * @param initial_handles_ptr Yeni göreve verilecek Handle listesine pointer (ABI'ye bağlı olarak nasıl geçirileceği değişir).
+ * @param initial_handles_ptr Yeni göreve verilecek Handle listesine pointer. Handle'lar yeni göreve taşınır (bkz. sahne_task_get_initial_handles).
  * @param initial_handles_len Handle listesi uzunluğu.
  * @param out_task_id Başarı durumunda yeni Task ID saklamak için çıkış parametresi.
  * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
@@ -193,6 +459,59 @@ sahne_error_t sahne_mem_unmap_shared(void* addr, size_t size);
 sahne_error_t sahne_task_spawn(sahne_handle_t code_handle, const uint8_t* args_ptr, size_t args_len, const sahne_handle_t* initial_handles_ptr, size_t initial_handles_len, sahne_task_id_t* out_task_id);
 
 
+/**
+ * (Yeni) Mevcut göreve sahne_task_spawn ile verilen başlangıç handle'larını alır.
+ * Başlangıç handle'ları kanal aktarımıyla aynı sahiplik kurallarına tabidir: spawn eden görevden
+ * yeni göreve taşınırlar ve initial_handles dizisindeki sırayla döner. Geleneksel olarak
+ * ilk handle, görevin ebeveyniyle konuştuğu kanal ucudur.
+ * @param out_handles Handle'ların yazılacağı dizi.
+ * @param max_handles Dizinin kapasitesi.
+ * @param out_count Başarı durumunda toplam başlangıç handle sayısını saklamak için çıkış parametresi (kapasiteden büyük olabilir).
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_task_get_initial_handles(sahne_handle_t* out_handles, size_t max_handles, size_t* out_count);
+
+/**
+ * (Yeni) Bir görev şablonu (template) oluşturur.
+ * Çekirdek kodu normal spawn gibi başlatır; görev ilklendirmesini bitirip sahne_task_template_checkpoint
+ * çağırdığında adres alanı ve handle tablosu dondurulur ve şablon olarak saklanır. Bu çağrı o ana kadar bloklar.
+ * Şablondan üretilen görevler bu imajı copy-on-write olarak paylaşır; ilklendirme maliyeti bir kez ödenir.
+ * @param code_handle Çalıştırılabilir kodu içeren kaynağın handle'ı.
+ * @param args_ptr İlklendirme çalışmasına iletilecek argüman verisi.
+ * @param args_len Argüman verisi uzunluğu.
+ * @param initial_handles_ptr İlklendirme çalışmasına taşınacak handle'lar (şablonun parçası olur).
+ * @param initial_handles_len Handle sayısı.
+ * @param out_template_handle Başarı durumunda şablon handle'ını saklamak için çıkış parametresi (sahne_resource_release ile bırakılır).
+ * @return SAHNE_SUCCESS başarı durumunda, SAHNE_ERROR_TASK_CREATION_FAILED görev checkpoint'e ulaşmadan sonlanırsa, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_task_template_create(sahne_handle_t code_handle, const uint8_t* args_ptr, size_t args_len, const sahne_handle_t* initial_handles_ptr, size_t initial_handles_len, sahne_handle_t* out_template_handle);
+
+/**
+ * (Yeni) Şablon ilklendirmesinin bittiği noktayı işaretler.
+ * sahne_task_template_create ile başlatılan görevde çağrıldığında görev dondurulur ve bu çağrıdan geri dönmez.
+ * Şablondan üretilen her görev ise yürütmeye bu çağrının dönüşünden başlar; kendi argümanları args_buf'a kopyalanır
+ * ve kendi başlangıç handle'ları sahne_task_get_initial_handles ile alınabilir.
+ * Şablon dışında çalışan bir görevde SAHNE_ERROR_INVALID_OPERATION döner.
+ * @param args_buf Klonun argümanlarının kopyalanacağı tampon (args_buf_len 0 ise NULL olabilir).
+ * @param args_buf_len Tamponun boyutu.
+ * @param out_args_len Klonun argüman uzunluğunu saklamak için çıkış parametresi (tampondan büyükse veri kırpılır).
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_task_template_checkpoint(uint8_t* args_buf, size_t args_buf_len, size_t* out_args_len);
+
+/**
+ * (Yeni) Bir şablondan copy-on-write klon olarak yeni görev başlatır.
+ * Klon, sahne_task_template_checkpoint dönüşünden devam eder; kod yükleme ve ilklendirme maliyeti ödenmez.
+ * @param template_handle sahne_task_template_create ile oluşturulan şablonun handle'ı.
+ * @param args_ptr Klona iletilecek argüman verisi.
+ * @param args_len Argüman verisi uzunluğu.
+ * @param initial_handles_ptr Klona taşınacak handle'lar (sahne_task_spawn ile aynı kurallar).
+ * @param initial_handles_len Handle sayısı.
+ * @param out_task_id Başarı durumunda yeni Task ID saklamak için çıkış parametresi.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_task_spawn_from_template(sahne_handle_t template_handle, const uint8_t* args_ptr, size_t args_len, const sahne_handle_t* initial_handles_ptr, size_t initial_handles_len, sahne_task_id_t* out_task_id);
+
 /**
  * Mevcut görevi belirtilen çıkış koduyla sonlandırır. Geri dönmez.
  * @param code Çıkış kodu.
@@ -213,6 +532,13 @@ sahne_error_t sahne_task_current_id(sahne_task_id_t* out_task_id);
  */
 sahne_error_t sahne_task_sleep(uint64_t milliseconds);
 
+/**
+ * (Yeni) Mevcut görevi nanosaniye hassasiyetinde uyutur.
+ * @param nanoseconds Uyutulacak süre (nanosaniye). Çekirdek saat çözünürlüğüne yuvarlanabilir.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_task_sleep_ns(uint64_t nanoseconds);
+
 /**
  * Yeni bir iş parçacığı (thread) oluşturur.
  * @param entry_point_fn Yeni iş parçacığının başlangıç fonksiyon pointer'ı.
@@ -245,6 +571,30 @@ sahne_error_t sahne_task_yield(void);
 sahne_error_t sahne_task_wait_for_exit(sahne_task_id_t task_id, int32_t* out_exit_code);
 
 
+/**
+ * (Yeni) Bir görev için poll edilebilir handle edinir.
+ * Görev sonlandığında handle SAHNE_POLL_TASK_EXITED olayını üretir; böylece görevler kanallarla
+ * aynı poll kümesinde beklenebilir. Handle sahne_resource_release ile bırakılır.
+ * @param task_id Görevin ID'si (çağıranın çocuğu olmalıdır).
+ * @param out_handle Başarı durumunda görev handle'ını saklamak için çıkış parametresi.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_task_open(sahne_task_id_t task_id, sahne_handle_t* out_handle);
+
+/**
+ * (Yeni) Birden çok görevin sonlanmasını tek çağrıda bekler ve çıkış kodlarını toplu döner.
+ * Sonlanan her görev bir kez raporlanır ve sistemden temizlenir (sahne_task_wait_for_exit ile aynı).
+ * @param task_ids Beklenecek görev ID'leri (SAHNE_TASK_WAIT_CHILDREN ile NULL olabilir).
+ * @param count task_ids uzunluğu; SAHNE_TASK_WAIT_CHILDREN ile yalnızca sonuç kapasitesidir.
+ * @param flags SAHNE_TASK_WAIT_* bayrakları.
+ * @param timeout_ms Ne kadar bekleneceği (milisaniye). -1 sonsuz, 0 non-blocking.
+ * @param out_results Sonlanan görevlerin yazılacağı dizi (en az count eleman).
+ * @param out_reaped Başarı durumunda out_results'a yazılan görev sayısını saklamak için çıkış parametresi.
+ * @return SAHNE_SUCCESS başarı durumunda; süre koşul sağlanmadan dolarsa da SAHNE_SUCCESS döner ve yalnızca
+ * o ana kadar sonlananlar raporlanır (*out_reaped 0 olabilir). Aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_task_wait_many(const sahne_task_id_t* task_ids, size_t count, uint32_t flags, int64_t timeout_ms, TaskExitStatus_t* out_results, size_t* out_reaped);
+
 // --- Kaynak Yönetimi ---
 /**
  * Belirtilen ID'ye sahip bir kaynağa erişim handle'ı edinir.
@@ -311,6 +661,87 @@ sahne_error_t sahne_resource_seek(sahne_handle_t handle, uint64_t whence, int64_
  */
 sahne_error_t sahne_resource_stat(sahne_handle_t handle, ResourceStatus_t* out_status);
 
+/**
+ * (Yeni) Bir dizin (isim alanı) handle'ının girdilerini toplu olarak listeler. Tampona sığdığı kadar
+ * DirEntry_t kaydı, her biri durum bilgisiyle birlikte yazılır; böylece girdi başına acquire + stat + release
+ * yerine tek sistem çağrısı yeterlidir. Büyük dizinler çerez (cookie) ile parça parça okunur.
+ * @param dir_handle SAHNE_MODE_READ ile edinilmiş dizin handle'ı.
+ * @param buffer Kayıtların yazılacağı tampon (SAHNE_DIR_ENTRY_ALIGN hizalı olmalı).
+ * @param buffer_len Tampon boyutu. En az bir kayıt sığmazsa SAHNE_ERROR_INVALID_PARAMETER döner.
+ * @param inout_cookie Giriş: SAHNE_ENUM_COOKIE_START veya önceki çağrıdan dönen çerez. Çıkış: son yazılan kaydın çerezi.
+ * @param out_count Yazılan kayıt sayısı. 0 ise dizinin sonuna gelinmiştir.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_resource_enumerate(sahne_handle_t dir_handle, uint8_t* buffer, size_t buffer_len,
+                                       uint64_t* inout_cookie, size_t* out_count);
+
+/**
+ * (Yeni) Bir kaynaktan diğerine (veya bir kanala) veriyi çekirdek içinde kopyalar (sendfile/splice benzeri).
+ * Veri kullanıcı alanına taşınmaz; çekirdek yalnızca iki kaynak arasında doğrudan aktarım mümkün değilse
+ * dahili bir ara tampon kullanır. Kısa kopya olabilir (örn. kaynağın sonu, kanal kapasitesi);
+ * *out_copied 0 ise kaynağın sonuna gelinmiştir.
+ * @param src_handle Okuma izinli kaynak handle'ı.
+ * @param src_offset Kaynaktaki ofset veya SAHNE_COPY_OFFSET_CURRENT (handle konumu ilerletilir).
+ * @param dst_handle Yazma izinli hedef handle'ı (kaynak veya kanal).
+ * @param dst_offset Hedefteki ofset veya SAHNE_COPY_OFFSET_CURRENT.
+ * @param len Kopyalanacak en fazla byte sayısı.
+ * @param out_copied Başarı durumunda kopyalanan byte sayısı.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_resource_copy_range(sahne_handle_t src_handle, uint64_t src_offset,
+                                        sahne_handle_t dst_handle, uint64_t dst_offset,
+                                        uint64_t len, uint64_t* out_copied);
+
+/**
+ * (Yeni) Kaynağa yapılmış yazmaları cihaza gönderir ve isteğe bağlı olarak kalıcı olmalarını bekler.
+ * sahne_resource_write tek başına kalıcılık garantisi vermez; bu çağrı başarıyla döndükten sonra,
+ * çağrıdan önce tamamlanmış tüm yazmalar (hangi iş parçacığından gelirse gelsin) kalıcıdır.
+ * @param handle Yazma izinli kaynak handle'ı.
+ * @param flags SAHNE_SYNC_* bayrakları.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu. Hata sonrası aynı yazmaların
+ * kalıcılığı garanti edilmez; yeniden denemek yerine kaynak hatalı kabul edilmelidir.
+ */
+sahne_error_t sahne_resource_sync(sahne_handle_t handle, uint32_t flags);
+
+/**
+ * (Yeni) sahne_resource_sync(handle, SAHNE_SYNC_FLUSH) ile aynıdır.
+ */
+sahne_error_t sahne_resource_flush(sahne_handle_t handle);
+
+/**
+ * (Yeni) Bu görevin sunacağı bir kaynak adı yayınlar (örn. "sahne://metrics/42").
+ * Başka bir görev bu adı veya "<ad>/<alt yol>" adını sahne_resource_acquire ile açıp sahne_resource_read
+ * çağırdığında çekirdek, dönen kanal handle'ına bir rpc:: isteği gönderir (SahneRpcHeader_t,
+ * method = SAHNE_RESOURCE_METHOD_READ, veri = SahneResourceReadRequest_t + alt yol) ve okuyucuyu bekletir.
+ * Sunucu aynı kanaldan SAHNE_RPC_KIND_RESPONSE ile en fazla max_len byte yanıt verir; veri okuyucunun
+ * tamponuna kopyalanır, yanıtın status alanı okuyucuya hata kodu olarak döner. Böylece okuyucu tüm
+ * içeriği tek bir sahne_resource_read ile alır. Kanal handle'ı bırakıldığında ad kaldırılır.
+ * @param name_ptr Yayınlanacak kaynak adı.
+ * @param name_len Ad uzunluğu.
+ * @param out_channel_handle Başarı durumunda isteklerin geleceği kanal handle'ı.
+ * @return SAHNE_SUCCESS başarı durumunda; ad kullanımdaysa SAHNE_ERROR_NAMING_ERROR, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_resource_publish(const uint8_t* name_ptr, size_t name_len, sahne_handle_t* out_channel_handle);
+
+/**
+ * (Yeni) Kaynağın bir aralığı için erişim biçimini bildirir (read-ahead ve önbellek tahliyesini yönlendirir).
+ * Tavsiye yalnızca performansı etkiler; okuma/yazma sonuçlarını değiştirmez. Desteklenmeyen kaynaklarda
+ * SAHNE_ERROR_NOT_SUPPORTED döner ve güvenle yok sayılabilir.
+ * @param handle Kaynak handle'ı.
+ * @param offset Aralığın başlangıcı.
+ * @param len Aralık uzunluğu (SAHNE_ADVISE_TO_END: kaynağın sonuna kadar).
+ * @param advice SAHNE_ADVICE_* (SAHNE_ADVICE_HUGEPAGE hariç).
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_resource_advise(sahne_handle_t handle, uint64_t offset, uint64_t len, uint32_t advice);
+
+/**
+ * (Yeni) Aralığı arka planda belleğe getirmeye başlar ve hemen döner (asenkron önden getirme).
+ * Sonraki sahne_resource_read çağrıları veriyi cihazı beklemeden alır.
+ * sahne_resource_advise(handle, offset, len, SAHNE_ADVICE_WILLNEED) ile aynıdır.
+ */
+sahne_error_t sahne_resource_prefetch(sahne_handle_t handle, uint64_t offset, uint64_t len);
+
 
 // --- Çekirdek Etkileşimi ---
 /**
@@ -328,6 +759,35 @@ sahne_error_t sahne_kernel_get_info(uint32_t info_type, uint64_t* out_value);
  */
 sahne_error_t sahne_kernel_get_time(uint64_t* out_time);
 
+// sahne_kernel_get_stats ile tek çağrıda alınan çekirdek ve görev istatistikleri (repr(C) uyumlu).
+// İlk iki alan sürümlemeyi sağlar: çekirdek en fazla `size` byte doldurur, bilmediği alanlar 0 kalır.
+typedef struct KernelStats_t {
+    uint32_t version;             // Giriş: SAHNE_KERNEL_STATS_VERSION, çıkış: çekirdeğin doldurduğu sürüm
+    uint32_t size;                // Giriş: sizeof(KernelStats_t)
+    // SAHNE_KERNEL_INFO_* anahtarlarının karşılıkları
+    uint64_t version_major;
+    uint64_t version_minor;
+    uint64_t build_id;
+    uint64_t uptime_seconds;
+    uint64_t architecture;
+    uint64_t total_memory_bytes;
+    uint64_t free_memory_bytes;
+    uint32_t memory_pressure;     // Anlık SAHNE_MEM_PRESSURE_* seviyesi
+    uint32_t reserved;            // Hizalanma
+    // Çağıran göreve ait değerler
+    uint64_t task_memory_bytes;   // Görevin kullandığı bellek (byte)
+    uint64_t task_handle_count;   // Görevin açık handle sayısı
+    uint64_t task_cpu_time_ns;    // Görevin toplam CPU süresi (nanosaniye)
+} KernelStats_t;
+
+/**
+ * (Yeni) Tüm SAHNE_KERNEL_INFO_* değerlerini ve çağıran görevin bellek, handle ve CPU kullanımını
+ * tek sistem çağrısıyla tutarlı bir anlık görüntü olarak alır (her anahtar için ayrı sahne_kernel_get_info gerekmez).
+ * @param out_stats Doldurulacak yapı. version ve size alanları fonksiyon tarafından ayarlanır.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_kernel_get_stats(KernelStats_t* out_stats);
+
 
 // --- Senkronizasyon ---
 /**
@@ -360,6 +820,16 @@ sahne_error_t sahne_sync_lock_release(sahne_handle_t handle);
  */
 sahne_error_t sahne_channel_create(sahne_handle_t* out_channel_handle);
 
+/**
+ * (Yeni) Birbirine bağlı iki kanal ucu oluşturur.
+ * a ucundan gönderilen mesajlar b ucundan alınır ve tersi de geçerlidir. Uçlardan biri
+ * sahne_task_spawn initial_handles veya sahne_channel_send_with_handles ile başka bir göreve devredilebilir.
+ * @param out_handle_a Başarı durumunda birinci ucu saklamak için çıkış parametresi.
+ * @param out_handle_b Başarı durumunda ikinci ucu saklamak için çıkış parametresi.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_channel_create_pair(sahne_handle_t* out_handle_a, sahne_handle_t* out_handle_b);
+
 /**
  * (Yeni) Mevcut bir mesaj kanalına ID'si üzerinden bağlanır.
  * @param channel_id_ptr Kanal ID pointer'ı (byte dizisi).
@@ -388,6 +858,58 @@ sahne_error_t sahne_channel_send(sahne_handle_t channel_handle, const uint8_t* m
  */
 sahne_error_t sahne_channel_receive(sahne_handle_t channel_handle, uint8_t* buffer_ptr, size_t buffer_len, size_t* out_bytes_received);
 
+/**
+ * (Yeni) Çerçevelenmiş birden çok mesajı tek sistem çağrısıyla gönderir.
+ * Her çerçeve ayrı bir mesaj olarak kanala eklenir; alıcı taraf bunları tek tek
+ * (sahne_channel_receive) veya toplu (sahne_channel_receive_many) alabilir.
+ * Kanal dolarsa yalnızca sığan çerçeveler gönderilir, mesajlar asla bölünmez.
+ * @param channel_handle Mesajların gönderileceği kanalın handle'ı.
+ * @param frames_ptr SAHNE_CHANNEL_FRAME_* formatında dizilmiş çerçeveler.
+ * @param frames_len Çerçeve tamponunun toplam uzunluğu.
+ * @param out_sent_count Başarı durumunda gönderilen mesaj sayısını saklamak için çıkış parametresi.
+ * @return SAHNE_SUCCESS en az bir mesaj gönderildiyse, SAHNE_ERROR_WOULD_BLOCK non-blocking kanal doluysa, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_channel_send_many(sahne_handle_t channel_handle, const uint8_t* frames_ptr, size_t frames_len, size_t* out_sent_count);
+
+/**
+ * (Yeni) Kanaldaki mesajlardan tampona sığdığı kadarını tek sistem çağrısıyla alır.
+ * Mesajlar tampona SAHNE_CHANNEL_FRAME_* formatında yazılır ve her biri için spans dizisine bir giriş doldurulur.
+ * @param channel_handle Mesajların alınacağı kanalın handle'ı.
+ * @param buffer_ptr Çerçevelerin kopyalanacağı tampon pointer'ı.
+ * @param buffer_len Tamponun boyutu.
+ * @param spans Alınan her mesajın ofset/uzunluk bilgisinin yazılacağı dizi.
+ * @param max_spans spans dizisinin kapasitesi (alınacak en fazla mesaj sayısı).
+ * @param out_count Başarı durumunda alınan mesaj sayısını saklamak için çıkış parametresi.
+ * @return SAHNE_SUCCESS başarı durumunda, SAHNE_ERROR_NO_MESSAGE non-blocking durumda mesaj yoksa,
+ * SAHNE_ERROR_INVALID_PARAMETER sıradaki mesaj boş tampona bile sığmıyorsa (mesaj kanalda kalır), aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_channel_receive_many(sahne_handle_t channel_handle, uint8_t* buffer_ptr, size_t buffer_len, MessageSpan_t* spans, size_t max_spans, size_t* out_count);
+
+/**
+ * (Yeni) Mesajla birlikte handle'ları da kanal üzerinden aktarır.
+ * Paylaşımlı bellek, kaynak ve kanal handle'ları eklenebilir. Aktarılan handle'lar gönderen görevin
+ * handle tablosundan çıkarılır ve alıcıya taşınır (sahiplik devri). Gönderenin mevcut paylaşımlı bellek
+ * eşlemeleri geçerli kalır; böylece büyük bir tampon kopyalanmadan O(1) maliyetle devredilebilir.
+ * Gönderim başarısız olursa handle'lar gönderende kalır.
+ * @param channel_handle Mesajın gönderileceği kanalın handle'ı.
+ * @param message_ptr Gönderilecek mesaj verisi pointer'ı (message_len 0 ise NULL olabilir).
+ * @param message_len Mesaj verisi uzunluğu.
+ * @param handles_ptr Aktarılacak handle dizisi.
+ * @param handles_len Handle sayısı (en fazla SAHNE_CHANNEL_MAX_HANDLES).
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_channel_send_with_handles(sahne_handle_t channel_handle, const uint8_t* message_ptr, size_t message_len, const sahne_handle_t* handles_ptr, size_t handles_len);
+
+/**
+ * (Yeni) Kanaldan bir mesajı ve ona eklenmiş handle'ları alır.
+ * Aktarılan handle'lar alıcı görevin handle tablosuna eklenir; serbest bırakmak alıcının sorumluluğudur.
+ * @param channel_handle Mesajın alınacağı kanalın handle'ı.
+ * @param envelope Veri/handle tamponları ve kapasiteleri; çekirdek data_len ve handles_len alanlarını doldurur.
+ * @return SAHNE_SUCCESS başarı durumunda, SAHNE_ERROR_NO_MESSAGE non-blocking durumda mesaj yoksa,
+ * SAHNE_ERROR_INVALID_PARAMETER veri veya handle kapasitesi yetersizse (mesaj kanalda kalır), aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_channel_receive_with_handles(sahne_handle_t channel_handle, ChannelEnvelope_t* envelope);
+
 // NOT: Eski Task ID'ye doğrudan mesaj gönderme/alma fonksiyonları (sahne_msg_send, sahne_msg_receive)
 // yeni kanallarla birlikte kullanım durumuna göre burada kalabilir veya kaldırılabilir.
 // Şu anki güncellemeyle bunlar da korunmuş oldu.
@@ -404,6 +926,95 @@ sahne_error_t sahne_channel_receive(sahne_handle_t channel_handle, uint8_t* buff
  */
 int64_t sahne_poll(PollEntry_t* entries, size_t num_entries, int64_t timeout_ms);
 
+/**
+ * (Yeni) sahne_poll ile aynıdır, ancak zaman aşımı nanosaniye cinsindendir.
+ * @param timeout_ns Ne kadar bekleneceği (nanosaniye). -1 sonsuz bekleme. 0 non-blocking.
+ * @return sahne_poll ile aynı.
+ */
+int64_t sahne_poll_ns(PollEntry_t* entries, size_t num_entries, int64_t timeout_ns);
+
+
+// --- Zamanlayıcılar (Timer) ---
+/**
+ * (Yeni) Poll edilebilir bir zamanlayıcı handle'ı oluşturur (başlangıçta kurulmamıştır).
+ * Zamanlayıcı dolduğunda handle SAHNE_POLL_READABLE olur. sahne_resource_read ile 8 byte okunduğunda
+ * son okumadan beri dolma sayısı (uint64_t) döner ve sayaç sıfırlanır. Handle sahne_resource_release ile bırakılır.
+ * @param out_handle Başarı durumunda zamanlayıcı handle'ını saklamak için çıkış parametresi.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_timer_create(sahne_handle_t* out_handle);
+
+/**
+ * (Yeni) Zamanlayıcıyı kurar, yeniden kurar veya durdurur.
+ * @param handle Zamanlayıcı handle'ı.
+ * @param initial_ns İlk dolma zamanı (SAHNE_TIMER_RELATIVE ise göreli, SAHNE_TIMER_ABSOLUTE ise mutlak). 0 zamanlayıcıyı durdurur.
+ * @param interval_ns 0 ise tek seferlik (one-shot), aksi halde ilk dolmadan sonraki periyot.
+ * @param flags SAHNE_TIMER_* bayrakları.
+ * @return SAHNE_SUCCESS başarı durumunda, aksi halde bir hata kodu.
+ */
+sahne_error_t sahne_timer_set(sahne_handle_t handle, uint64_t initial_ns, uint64_t interval_ns, uint32_t flags);
+
+
+// --- Sağlama Toplamları (Checksum) ---
+// Hesaplama kullanıcı alanında yapılır (sistem çağrısı yok). CRC32C çekirdeği çalışma zamanında seçilir:
+// x86_64'te SSE4.2, aarch64'te ARMv8 CRC uzantısı (SAHNE_CPU_FEATURE_ARM_CRC32), aksi halde tablo tabanlı skaler kod.
+
+// Algoritmalar
+#define SAHNE_CHECKSUM_CRC32C   1
+#define SAHNE_CHECKSUM_XXHASH64 2
+
+// CRC32C çekirdekleri (sahne_checksum_kernels maskesinde 1 << çekirdek)
+#define SAHNE_CHECKSUM_KERNEL_SCALAR  0
+#define SAHNE_CHECKSUM_KERNEL_SSE42   1
+#define SAHNE_CHECKSUM_KERNEL_ARM_CRC 2
+
+// Blok sağlama toplamı yan dosyası (sidecar): [ChecksumSidecarHeader_t][blok başına uint64_t (little-endian)]
+// Blok i, veri kaynağında i * block_size ofsetindedir; son blok kısa olabilir. CRC32C değerleri sıfırla genişletilir.
+#define SAHNE_CHECKSUM_SIDECAR_MAGIC   0x314B4353 // "SCK1"
+#define SAHNE_CHECKSUM_SIDECAR_VERSION 1
+
+typedef struct ChecksumSidecarHeader_t {
+    uint32_t magic;      // SAHNE_CHECKSUM_SIDECAR_MAGIC
+    uint16_t version;    // SAHNE_CHECKSUM_SIDECAR_VERSION
+    uint16_t algorithm;  // SAHNE_CHECKSUM_*
+    uint32_t block_size;
+    uint32_t reserved;
+} ChecksumSidecarHeader_t;
+
+/**
+ * (Yeni) CRC32C (Castagnoli) hesaplar. Parça parça hesaplama için önceki sonuç `crc` olarak verilir.
+ * @param crc Önceki sonuç; ilk parça için 0.
+ * @return Güncellenmiş CRC32C.
+ */
+uint32_t sahne_crc32c(uint32_t crc, const uint8_t* data, size_t len);
+
+/**
+ * (Yeni) crc1 = CRC32C(A) ve crc2 = CRC32C(B) iken veriyi yeniden okumadan CRC32C(A || B)'yi hesaplar.
+ * @param len2 B'nin byte uzunluğu.
+ */
+uint32_t sahne_crc32c_combine(uint32_t crc1, uint32_t crc2, uint64_t len2);
+
+/**
+ * (Yeni) xxHash64 hesaplar.
+ */
+uint64_t sahne_xxhash64(const uint8_t* data, size_t len, uint64_t seed);
+
+/**
+ * (Yeni) Bu işlemcide kullanılabilir CRC32C çekirdeklerinin maskesi (bit 1 << SAHNE_CHECKSUM_KERNEL_*).
+ */
+uint32_t sahne_checksum_kernels(void);
+
+/**
+ * (Yeni) sahne_crc32c'nin kullandığı (kullanılabilir en hızlı) çekirdek.
+ */
+uint32_t sahne_checksum_active_kernel(void);
+
+/**
+ * (Yeni) Belirli bir çekirdekle CRC32C hesaplar (çekirdekleri karşılaştırmak/ölçmek için).
+ * @return SAHNE_SUCCESS veya çekirdek bu işlemcide yoksa SAHNE_ERROR_NOT_SUPPORTED.
+ */
+sahne_error_t sahne_crc32c_with_kernel(uint32_t kernel, uint32_t crc, const uint8_t* data, size_t len, uint32_t* out_crc);
+
 
 #ifdef __cplusplus
 } // extern "C"
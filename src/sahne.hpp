@@ -0,0 +1,481 @@
+#ifndef SAHNE_HPP
+#define SAHNE_HPP
+
+// Sahne64 C API'si (sahne.h) üzerinde ince C++ sarmalayıcıları.
+// Hata yönetimi C API ile aynıdır: fonksiyonlar sahne_error_t döner, istisna (exception) fırlatılmaz.
+
+#include "sahne.h"
+
+#include <algorithm> // std::min
+#include <cstdint>  // uint*_t
+#include <cstddef>  // size_t
+#include <cstring>  // std::memcpy
+#include <string>   // std::string
+#include <string_view> // std::string_view
+#include <utility>  // std::swap
+#include <vector>   // std::vector
+
+namespace sahne {
+
+/// Çekirdekten dönen ham negatif kodu (örn. sahne_poll dönüşü) SAHNE_ERROR_* koduna çevirir.
+/// sahne64.rs map_kernel_error ile aynı eşleşmeyi kullanır.
+inline sahne_error_t map_kernel_error(int64_t code) {
+    switch (code) {
+        case -1:   return SAHNE_ERROR_PERMISSION_DENIED;
+        case -2:   return SAHNE_ERROR_RESOURCE_NOT_FOUND;
+        case -3:   return SAHNE_ERROR_INVALID_PARAMETER;
+        case -4:   return SAHNE_ERROR_INTERRUPTED;
+        case -9:   return SAHNE_ERROR_INVALID_HANDLE;
+        case -11:  return SAHNE_ERROR_RESOURCE_BUSY;
+        case -12:  return SAHNE_ERROR_OUT_OF_MEMORY;
+        case -14:  return SAHNE_ERROR_INVALID_ADDRESS;
+        case -17:  return SAHNE_ERROR_NAMING_ERROR;
+        case -38:  return SAHNE_ERROR_NOT_SUPPORTED;
+        case -61:  return SAHNE_ERROR_NO_MESSAGE;
+        case -74:  return SAHNE_ERROR_CHECKSUM_MISMATCH;
+        case -101: return SAHNE_ERROR_WOULD_BLOCK;
+        case -102: return SAHNE_ERROR_DISCONNECTED;
+        case -110: return SAHNE_ERROR_TIMED_OUT;
+        default:   return SAHNE_ERROR_UNKNOWN_SYSCALL;
+    }
+}
+
+// --- Çekirdek Etkileşimi ---
+namespace kernel {
+
+/// Tüm çekirdek bilgilerini ve bu görevin bellek/handle/CPU kullanımını tek çağrıda alır.
+inline sahne_error_t get_stats(KernelStats_t& out) {
+    out = KernelStats_t{};
+    return sahne_kernel_get_stats(&out);
+}
+
+} // namespace kernel
+
+// --- Kaynak Yönetimi ---
+namespace resource {
+
+/// sahne_resource_enumerate ile alınan bir dizin girdisi. `name` listeleme tamponunu gösterir ve
+/// yalnızca geri çağırma süresince geçerlidir.
+struct DirEntryView {
+    DirEntry_t entry;
+    std::string_view name;
+
+    bool is_directory() const {
+        return (entry.status.type_flags & SAHNE_RESOURCE_TYPE_MASK) == SAHNE_RESOURCE_TYPE_DIRECTORY;
+    }
+};
+
+/// Dizin handle'ının tüm girdileri için on_entry(const DirEntryView&) çağırır. `buffer` çağrılar arasında
+/// yeniden kullanılır (boşsa 64 KiB ayrılır); her sahne_resource_enumerate çağrısı tampon dolusu girdi getirir.
+/// on_entry false dönerse listeleme durur.
+template <typename F>
+sahne_error_t for_each_entry(sahne_handle_t dir_handle, std::vector<uint8_t>& buffer, F&& on_entry) {
+    if (buffer.empty()) {
+        buffer.resize(64 * 1024);
+    }
+    uint64_t cookie = SAHNE_ENUM_COOKIE_START;
+    for (;;) {
+        size_t count = 0;
+        sahne_error_t err = sahne_resource_enumerate(dir_handle, buffer.data(), buffer.size(), &cookie, &count);
+        if (err != SAHNE_SUCCESS || count == 0) {
+            return err;
+        }
+        size_t offset = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (offset + sizeof(DirEntry_t) > buffer.size()) {
+                return SAHNE_ERROR_COMMUNICATION_ERROR; // Sayılan kayıtlar tampona sığmıyor
+            }
+            DirEntryView view;
+            std::memcpy(&view.entry, buffer.data() + offset, sizeof(DirEntry_t));
+            // Kayıt en az başlık + isim kadar olmalı; yoksa sonraki kayıt ismin üzerine biner
+            if (view.entry.record_len < sizeof(DirEntry_t) + view.entry.name_len ||
+                offset + sizeof(DirEntry_t) + view.entry.name_len > buffer.size()) {
+                return SAHNE_ERROR_COMMUNICATION_ERROR; // Bozuk kayıt
+            }
+            view.name = std::string_view(SAHNE_DIR_ENTRY_NAME(buffer.data() + offset), view.entry.name_len);
+            if (!on_entry(static_cast<const DirEntryView&>(view))) {
+                return SAHNE_SUCCESS;
+            }
+            offset += view.entry.record_len;
+        }
+    }
+}
+
+/// Kaynaktan hedefe en fazla `len` byte kopyalar; sahne_resource_copy_range kısa kopyalarında tekrar çağrılır
+/// ve açık ofsetler ilerletilir (SAHNE_COPY_OFFSET_CURRENT handle konumunu kullanır). *out_copied toplam
+/// kopyalanan byte sayısını alır; kaynak `len`'den önce biterse daha az olabilir.
+/// Çekirdek çağrıyı desteklemiyorsa (SAHNE_ERROR_NOT_SUPPORTED) ve iki ofset de SAHNE_COPY_OFFSET_CURRENT ise
+/// okuma/yazma ile kullanıcı alanı tamponu üzerinden kopyalanır (bu karar ilk NOT_SUPPORTED'da sabitlenir).
+/// Hata durumunda *out_copied hedefe yazılmış byte sayısını içerir (sahne64.rs resource::copy_all'da
+/// bu geri dönüş yolu yoktur; NOT_SUPPORTED çağırana döner).
+inline sahne_error_t copy_all(sahne_handle_t src_handle, uint64_t src_offset, sahne_handle_t dst_handle,
+                              uint64_t dst_offset, uint64_t len, uint64_t* out_copied) {
+    *out_copied = 0;
+    const bool can_bounce = src_offset == SAHNE_COPY_OFFSET_CURRENT && dst_offset == SAHNE_COPY_OFFSET_CURRENT;
+    std::vector<uint8_t> bounce; // Yalnızca geri dönüş yolunda ayrılır; boş değilse geri dönüş yolu seçilmiştir
+    while (*out_copied < len) {
+        uint64_t copied = 0;
+        sahne_error_t err = SAHNE_ERROR_NOT_SUPPORTED;
+        if (bounce.empty()) {
+            err = sahne_resource_copy_range(src_handle, src_offset, dst_handle, dst_offset, len - *out_copied, &copied);
+        }
+        if (err == SAHNE_ERROR_NOT_SUPPORTED && can_bounce) {
+            if (bounce.empty()) {
+                uint64_t pos = 0;
+                if (sahne_resource_seek(src_handle, SAHNE_SEEK_CUR, 0, &pos) == SAHNE_SUCCESS) {
+                    sahne_resource_advise(src_handle, pos, SAHNE_ADVISE_TO_END, SAHNE_ADVICE_SEQUENTIAL); // En iyi çaba
+                }
+                bounce.resize(64 * 1024);
+            }
+            size_t chunk = static_cast<size_t>(std::min<uint64_t>(bounce.size(), len - *out_copied));
+            size_t read = 0;
+            err = sahne_resource_read(src_handle, bounce.data(), chunk, &read);
+            size_t written = 0;
+            while (err == SAHNE_SUCCESS && written < read) {
+                size_t n = 0;
+                err = sahne_resource_write(dst_handle, bounce.data() + written, read - written, &n);
+                if (err == SAHNE_SUCCESS && n == 0) {
+                    err = SAHNE_ERROR_INVALID_OPERATION; // Hedef ilerlemiyor
+                }
+                written += n;
+            }
+            copied = written; // Hata olsa bile hedefe yazılanlar sayılır
+        }
+        *out_copied += copied;
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        if (copied == 0) {
+            break; // Kaynağın sonu
+        }
+        if (src_offset != SAHNE_COPY_OFFSET_CURRENT) {
+            src_offset += copied;
+        }
+        if (dst_offset != SAHNE_COPY_OFFSET_CURRENT) {
+            dst_offset += copied;
+        }
+    }
+    return SAHNE_SUCCESS;
+}
+
+/// Kaynağı mevcut konumundan sonuna kadar `buffer` boyutunda (boşsa 256 KiB) parçalarla okur ve her parça için
+/// on_chunk(const uint8_t* data, size_t len) çağırır (false dönerse durur). Başta SAHNE_ADVICE_SEQUENTIAL
+/// bildirilir; her parça işlenirken sonraki `prefetch_bytes` arka planda getirilir (sahne_resource_prefetch),
+/// böylece soğuk taramalar cihaz gecikmesini parça işleme süresiyle örtüştürür. Tavsiyeler en iyi çabadır.
+template <typename F>
+sahne_error_t scan_sequential(sahne_handle_t handle, std::vector<uint8_t>& buffer, uint64_t prefetch_bytes, F&& on_chunk) {
+    if (buffer.empty()) {
+        buffer.resize(256 * 1024);
+    }
+    uint64_t pos = 0;
+    sahne_error_t err = sahne_resource_seek(handle, SAHNE_SEEK_CUR, 0, &pos);
+    if (err != SAHNE_SUCCESS) {
+        return err;
+    }
+    sahne_resource_advise(handle, pos, SAHNE_ADVISE_TO_END, SAHNE_ADVICE_SEQUENTIAL);
+    uint64_t prefetched_to = pos;
+    for (;;) {
+        // Önden getirme penceresini [pos + buffer, pos + buffer + prefetch_bytes) kadar ileride tut
+        uint64_t want = pos + buffer.size() + prefetch_bytes;
+        if (prefetch_bytes != 0 && want > prefetched_to) {
+            uint64_t from = std::max(prefetched_to, pos + buffer.size());
+            if (want > from) {
+                sahne_resource_prefetch(handle, from, want - from);
+            }
+            prefetched_to = want;
+        }
+        size_t n = 0;
+        err = sahne_resource_read(handle, buffer.data(), buffer.size(), &n);
+        if (err != SAHNE_SUCCESS || n == 0) {
+            return err;
+        }
+        pos += n;
+        if (!on_chunk(static_cast<const uint8_t*>(buffer.data()), n)) {
+            return SAHNE_SUCCESS;
+        }
+    }
+}
+
+} // namespace resource
+
+// --- Mesajlaşma / IPC ---
+namespace messaging {
+
+/// `len` byte'lık bir mesajın toplu gönderim tamponunda kapladığı çerçeve boyutu.
+constexpr size_t frame_size(size_t len) {
+    return SAHNE_CHANNEL_FRAME_SIZE(len);
+}
+
+/// Mesajları sahne_channel_send_many formatında (SAHNE_CHANNEL_FRAME_*) dizen yardımcı.
+class FrameBuilder {
+public:
+    FrameBuilder() = default;
+    explicit FrameBuilder(size_t reserve_bytes) { frames_.reserve(reserve_bytes); }
+
+    /// Bir mesajı sonraki çerçeveye kopyalar. Uzunluk 32-bit çerçeve başlığına sığmazsa
+    /// SAHNE_ERROR_INVALID_PARAMETER döner (sahne64.rs FrameWriter::push ile aynı).
+    sahne_error_t push(const uint8_t* data, size_t len) {
+        if (len > UINT32_MAX) {
+            return SAHNE_ERROR_INVALID_PARAMETER;
+        }
+        size_t offset = frames_.size();
+        frames_.resize(offset + frame_size(len), 0);
+        uint32_t len32 = static_cast<uint32_t>(len);
+        std::memcpy(frames_.data() + offset, &len32, SAHNE_CHANNEL_FRAME_HEADER_SIZE); // Little-endian varsayılır
+        if (len != 0) {
+            std::memcpy(frames_.data() + offset + SAHNE_CHANNEL_FRAME_HEADER_SIZE, data, len);
+        }
+        ++count_;
+        return SAHNE_SUCCESS;
+    }
+
+    sahne_error_t push(const std::string& message) {
+        return push(reinterpret_cast<const uint8_t*>(message.data()), message.size());
+    }
+
+    const uint8_t* data() const { return frames_.data(); }
+    size_t size_bytes() const { return frames_.size(); }
+    size_t count() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    void clear() {
+        frames_.clear();
+        count_ = 0;
+    }
+
+    /// Biriken çerçeveleri kanala gönderir. Kanal yalnızca bir kısmını kabul ederse
+    /// gönderilmeyen çerçeveler builder'da kalır; *out_sent gönderilen mesaj sayısını alır.
+    sahne_error_t flush(sahne_handle_t channel_handle, size_t* out_sent) {
+        *out_sent = 0;
+        if (empty()) {
+            return SAHNE_SUCCESS;
+        }
+        sahne_error_t err = sahne_channel_send_many(channel_handle, frames_.data(), frames_.size(), out_sent);
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        if (*out_sent >= count_) {
+            clear();
+            return SAHNE_SUCCESS;
+        }
+        size_t consumed = 0;
+        for (size_t i = 0; i < *out_sent; ++i) {
+            uint32_t len32 = 0;
+            std::memcpy(&len32, frames_.data() + consumed, SAHNE_CHANNEL_FRAME_HEADER_SIZE);
+            consumed += frame_size(len32);
+        }
+        frames_.erase(frames_.begin(), frames_.begin() + static_cast<std::ptrdiff_t>(consumed));
+        count_ -= *out_sent;
+        return SAHNE_SUCCESS;
+    }
+
+private:
+    std::vector<uint8_t> frames_;
+    size_t count_ = 0;
+};
+
+/// sahne_channel_receive_many için yeniden kullanılabilir alım tamponu.
+class ReceiveBatch {
+public:
+    ReceiveBatch(size_t buffer_bytes, size_t max_messages)
+        : buffer_(buffer_bytes), spans_(max_messages) {}
+
+    /// Kanaldan tampona sığdığı kadar mesaj alır.
+    sahne_error_t receive(sahne_handle_t channel_handle) {
+        count_ = 0;
+        return sahne_channel_receive_many(channel_handle, buffer_.data(), buffer_.size(), spans_.data(), spans_.size(), &count_);
+    }
+
+    size_t count() const { return count_; }
+    const uint8_t* message_data(size_t i) const { return buffer_.data() + spans_[i].offset; }
+    size_t message_len(size_t i) const { return spans_[i].len; }
+
+private:
+    std::vector<uint8_t> buffer_;
+    std::vector<MessageSpan_t> spans_;
+    size_t count_ = 0;
+};
+
+/// Paylaşımlı bellek tamponunu kanal üzerinden devreder; veri kopyalanmaz, yalnızca handle taşınır.
+/// Mesaj gövdesi geçerli veri uzunluğudur (uint64_t). Başarı sonrası shared_handle gönderende geçersizdir,
+/// ancak gönderenin mevcut eşlemesi geçerli kalır.
+inline sahne_error_t send_shared_buffer(sahne_handle_t channel_handle, sahne_handle_t shared_handle, size_t len) {
+    uint64_t header = static_cast<uint64_t>(len);
+    return sahne_channel_send_with_handles(channel_handle, reinterpret_cast<const uint8_t*>(&header), sizeof(header), &shared_handle, 1);
+}
+
+/// send_shared_buffer ile gönderilen bir tamponun handle'ını ve geçerli veri uzunluğunu alır.
+inline sahne_error_t receive_shared_buffer(sahne_handle_t channel_handle, sahne_handle_t* out_shared_handle, size_t* out_len) {
+    uint64_t header = 0;
+    sahne_handle_t handle = 0;
+    ChannelEnvelope_t envelope{};
+    envelope.data = reinterpret_cast<uint8_t*>(&header);
+    envelope.data_cap = sizeof(header);
+    envelope.handles = &handle;
+    envelope.handles_cap = 1;
+    sahne_error_t err = sahne_channel_receive_with_handles(channel_handle, &envelope);
+    if (err != SAHNE_SUCCESS) {
+        return err;
+    }
+    if (envelope.data_len != sizeof(header) || envelope.handles_len != 1) {
+        if (envelope.handles_len == 1) {
+            sahne_resource_release(handle); // Beklenmeyen mesaj: aktarılan handle'ı sızdırma
+        }
+        return SAHNE_ERROR_COMMUNICATION_ERROR;
+    }
+    *out_shared_handle = handle;
+    *out_len = static_cast<size_t>(header);
+    return SAHNE_SUCCESS;
+}
+
+} // namespace messaging
+
+// --- Görev Yönetimi ---
+namespace task {
+
+/// Çağıranın sonlanmış çocuk görevlerinden en fazla max_results tanesini tek çağrıda toplar.
+/// Gözetmen (supervisor) döngüleri için: her çocuk için ayrı sahne_task_wait_for_exit gerekmez.
+/// `out` önceki içeriği silinerek sonlanan görevlerle doldurulur (süre dolarsa boş kalabilir).
+inline sahne_error_t reap_children(std::vector<TaskExitStatus_t>& out, size_t max_results, int64_t timeout_ms) {
+    out.resize(max_results);
+    size_t reaped = 0;
+    sahne_error_t err = sahne_task_wait_many(nullptr, max_results, SAHNE_TASK_WAIT_CHILDREN, timeout_ms, out.data(), &reaped);
+    out.resize(err == SAHNE_SUCCESS ? reaped : 0);
+    return err;
+}
+
+/// Listedeki tüm görevlerin sonlanmasını bekler; çıkış kodları `out`'a görevlerin sonlanma sırasıyla yazılır.
+inline sahne_error_t wait_all(const std::vector<sahne_task_id_t>& task_ids, std::vector<TaskExitStatus_t>& out, int64_t timeout_ms) {
+    out.resize(task_ids.size());
+    size_t reaped = 0;
+    sahne_error_t err = sahne_task_wait_many(task_ids.data(), task_ids.size(), SAHNE_TASK_WAIT_ALL, timeout_ms, out.data(), &reaped);
+    out.resize(err == SAHNE_SUCCESS ? reaped : 0);
+    return err;
+}
+
+} // namespace task
+
+// --- Bellek Yönetimi ---
+namespace memory {
+
+/// Paylaşımlı bellek alanı ve bu görevdeki eşlemesi. Nesne yok edildiğinde eşleme kaldırılır;
+/// handle devredilmemişse (bkz. release_handle) serbest bırakılır.
+class SharedBuffer {
+public:
+    SharedBuffer() = default;
+    SharedBuffer(const SharedBuffer&) = delete;
+    SharedBuffer& operator=(const SharedBuffer&) = delete;
+    SharedBuffer(SharedBuffer&& other) noexcept { swap(other); }
+    SharedBuffer& operator=(SharedBuffer&& other) noexcept { reset(); swap(other); return *this; }
+    ~SharedBuffer() { reset(); }
+
+    /// Yeni bir paylaşımlı bellek alanı oluşturur ve eşler.
+    sahne_error_t create(size_t size) {
+        reset();
+        sahne_error_t err = sahne_mem_create_shared(size, &handle_);
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        return map_existing(handle_, size);
+    }
+
+    /// Başka bir görevden alınan handle'ı eşler (sahiplik bu nesneye geçer).
+    sahne_error_t map_existing(sahne_handle_t handle, size_t size) {
+        void* ptr = nullptr;
+        sahne_error_t err = sahne_mem_map_shared(handle, 0, size, &ptr);
+        handle_ = handle;
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        data_ = static_cast<uint8_t*>(ptr);
+        size_ = size;
+        return SAHNE_SUCCESS;
+    }
+
+    /// Handle'ın sahipliğini bırakır (örn. send_shared_buffer ile devretmeden önce); eşleme korunur.
+    sahne_handle_t release_handle() {
+        sahne_handle_t h = handle_;
+        handle_ = 0;
+        return h;
+    }
+
+    uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+    sahne_handle_t handle() const { return handle_; }
+
+    /// Eşlemenin tamamı için erişim tavsiyesi (SAHNE_ADVICE_*, bkz. sahne_mem_advise). Eşleme sayfa
+    /// hizalıdır; sayfa katı olmayan boyutlarda (örn. create(100)) uzunluğu çekirdek sayfaya yuvarlar.
+    sahne_error_t advise(uint32_t advice) const {
+        return data_ == nullptr ? SAHNE_ERROR_INVALID_OPERATION : sahne_mem_advise(data_, size_, advice);
+    }
+
+    void reset() {
+        if (data_ != nullptr) {
+            sahne_mem_unmap_shared(data_, size_);
+        }
+        if (handle_ != 0) {
+            sahne_resource_release(handle_);
+        }
+        data_ = nullptr;
+        size_ = 0;
+        handle_ = 0;
+    }
+
+private:
+    void swap(SharedBuffer& other) noexcept {
+        std::swap(handle_, other.handle_);
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+
+    sahne_handle_t handle_ = 0;
+    uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/// Bellek baskısı handle'ından anlık seviyeyi (SAHNE_MEM_PRESSURE_*) okur.
+inline sahne_error_t read_pressure_level(sahne_handle_t handle, uint32_t* out_level) {
+    size_t bytes_read = 0;
+    sahne_error_t err = sahne_resource_read(handle, reinterpret_cast<uint8_t*>(out_level), sizeof(uint32_t), &bytes_read);
+    if (err == SAHNE_SUCCESS && bytes_read != sizeof(uint32_t)) {
+        return SAHNE_ERROR_INVALID_OPERATION;
+    }
+    return err;
+}
+
+/// Bellek baskısı bildirimlerini dinleyen handle (RAII). handle() poll kümesine SAHNE_POLL_READABLE ile eklenir;
+/// hazır olduğunda read_level() yeni seviyeyi döner ve önbellekler buna göre küçültülür.
+class PressureMonitor {
+public:
+    PressureMonitor() = default;
+    PressureMonitor(const PressureMonitor&) = delete;
+    PressureMonitor& operator=(const PressureMonitor&) = delete;
+    PressureMonitor(PressureMonitor&& other) noexcept : handle_(other.handle_) { other.handle_ = 0; }
+    PressureMonitor& operator=(PressureMonitor&& other) noexcept { std::swap(handle_, other.handle_); return *this; }
+    ~PressureMonitor() { reset(); }
+
+    sahne_error_t open(uint32_t min_level) {
+        reset();
+        return sahne_mem_pressure_open(min_level, &handle_);
+    }
+
+    sahne_error_t read_level(uint32_t* out_level) const { return read_pressure_level(handle_, out_level); }
+
+    sahne_handle_t handle() const { return handle_; }
+
+    void reset() {
+        if (handle_ != 0) {
+            sahne_resource_release(handle_);
+        }
+        handle_ = 0;
+    }
+
+private:
+    sahne_handle_t handle_ = 0;
+};
+
+} // namespace memory
+
+} // namespace sahne
+
+#endif // SAHNE_HPP
@@ -43,6 +43,31 @@ pub mod arch {
     pub const SYSCALL_CHANNEL_SEND: u64 = 108;    // Kanal üzerinden mesaj gönder (Handle ile)
     pub const SYSCALL_CHANNEL_RECEIVE: u64 = 109; // Kanal üzerinden mesaj al (Handle ile)
     pub const SYSCALL_POLL: u64 = 110;            // Birden çok handle üzerinde olay bekle
+    pub const SYSCALL_CHANNEL_SEND_MANY: u64 = 111;    // Kanal üzerinden çerçevelenmiş çoklu mesaj gönder
+    pub const SYSCALL_CHANNEL_RECEIVE_MANY: u64 = 112; // Kanal üzerinden tampona sığan kadar mesaj al
+    pub const SYSCALL_CHANNEL_SEND_HANDLES: u64 = 113;    // Mesajla birlikte handle aktar (sahiplik devri)
+    pub const SYSCALL_CHANNEL_RECEIVE_HANDLES: u64 = 114; // Mesajı ve ekli handle'ları al
+    pub const SYSCALL_TASK_GET_INITIAL_HANDLES: u64 = 115; // spawn ile verilen başlangıç handle'larını al
+    pub const SYSCALL_TASK_TEMPLATE_CREATE: u64 = 116;     // İlklendirilmiş görev imajından şablon oluştur
+    pub const SYSCALL_TASK_TEMPLATE_CHECKPOINT: u64 = 117; // Şablon ilklendirmesinin bittiği nokta
+    pub const SYSCALL_TASK_SPAWN_FROM_TEMPLATE: u64 = 118; // Şablondan copy-on-write klon başlat
+    pub const SYSCALL_CHANNEL_CREATE_PAIR: u64 = 119;      // Birbirine bağlı iki kanal ucu oluştur
+    pub const SYSCALL_TASK_OPEN: u64 = 120;                // Görev için poll edilebilir handle al
+    pub const SYSCALL_TASK_WAIT_MANY: u64 = 121;           // Birden çok görevin sonlanmasını bekle (toplu)
+    pub const SYSCALL_TIMER_CREATE: u64 = 122;             // Poll edilebilir zamanlayıcı handle'ı oluştur
+    pub const SYSCALL_TIMER_SET: u64 = 123;                // Zamanlayıcıyı kur/durdur (ns, tek seferlik/periyodik)
+    pub const SYSCALL_TASK_SLEEP_NS: u64 = 124;            // Görevi nanosaniye hassasiyetinde uyut
+    pub const SYSCALL_POLL_NS: u64 = 125;                  // Nanosaniye zaman aşımlı poll
+    pub const SYSCALL_KERNEL_GET_STATS: u64 = 126;         // Tüm çekirdek bilgileri + görev istatistikleri (tek çağrı)
+    pub const SYSCALL_MEM_PRESSURE_OPEN: u64 = 127;        // Poll edilebilir bellek baskısı handle'ı aç
+    pub const SYSCALL_RESOURCE_ENUMERATE: u64 = 128;       // Dizin girdilerini durum bilgisiyle toplu listele
+    pub const SYSCALL_RESOURCE_COPY_RANGE: u64 = 129;      // İki handle arasında çekirdek içi kopya
+    pub const SYSCALL_RESOURCE_SYNC: u64 = 130;            // Yazmaları cihaza gönder / kalıcı olmasını bekle
+    pub const SYSCALL_SHARED_MEM_NOTIFY: u64 = 131;        // Paylaşımlı bellek izleyicilerini uyandır
+    pub const SYSCALL_SHARED_MEM_WATCH: u64 = 132;         // Paylaşımlı bellek için poll edilebilir izleme handle'ı aç
+    pub const SYSCALL_RESOURCE_PUBLISH: u64 = 133;         // Görevin sunduğu bir kaynak adı yayınla (istekler kanaldan gelir)
+    pub const SYSCALL_RESOURCE_ADVISE: u64 = 134;          // Kaynak aralığı için erişim tavsiyesi / önden getirme
+    pub const SYSCALL_MEM_ADVISE: u64 = 135;               // Eşlenmiş bellek aralığı için erişim tavsiyesi
     // Yeni eklenen Kernel Info türleri için de sabitler tanımlanabilir (kernel::KERNEL_INFO_*)
 
 }
@@ -118,6 +143,9 @@ pub enum SahneError {
     CommunicationError,   // Mesajlaşma veya IPC hatası (genel)
     WouldBlock,           // İşlem şu anda bloke olacak ama NonBlocking işaretli
     Disconnected,         // IPC kanalı/kaynak bağlantısı kapandı
+    TimedOut,             // İşlem son tarihi (deadline) geçti
+    ChecksumMismatch,     // Veri bütünlüğü doğrulaması başarısız (sağlama toplamı uyuşmuyor)
+    Lagged,               // Okuyucu geride kaldı, mesajların üzerine yazıldı (yayın kanalı)
     // ... Çekirdekten (Karnal64) gelebilecek yeni hata türleri buraya eklenebilir ...
 }
 
@@ -145,8 +173,10 @@ fn map_kernel_error(code: i64) -> SahneError {
         -17 => SahneError::NamingError, // veya KError::AlreadyExists (duruma göre)
         -38 => SahneError::NotSupported,
         -61 => SahneError::NoMessage,
+        -74 => SahneError::ChecksumMismatch, // KError::BadMessage (bozuk veri)
         -101 => SahneError::WouldBlock, // Yeni hata kodu eşleşmesi (örnek)
         -102 => SahneError::Disconnected, // Yeni hata kodu eşleşmesi (örnek)
+        -110 => SahneError::TimedOut,
         // TODO: Çekirdekteki (Karnal64) KError enum'undaki diğer değerler buraya eşlenmeli
         _ => SahneError::UnknownSystemCall, // Eşlenmemiş veya bilinmeyen negatif kod
     }
@@ -174,7 +204,7 @@ where
 
 // Bellek yönetimi modülü (Paylaşımlı bellek dahil)
 pub mod memory {
-    use super::{SahneError, arch, syscall, map_kernel_error, map_kernel_ok_result, Handle};
+    use super::{SahneError, arch, syscall, map_kernel_error, map_kernel_ok_result, Handle, resource};
     use core::ptr::NonNull; // Non-null pointer için daha güvenli temsil
 
     /// Belirtilen boyutta bellek ayırır.
@@ -245,6 +275,97 @@ pub mod memory {
             Ok(())
         }
     }
+
+    // (Yeni) Bellek baskısı seviyeleri (sahne.h SAHNE_MEM_PRESSURE_*)
+    pub const PRESSURE_NONE: u32 = 0;
+    pub const PRESSURE_LOW: u32 = 1;      // Önbellekler küçülmeye başlamalı
+    pub const PRESSURE_MEDIUM: u32 = 2;   // Gereksiz bellek bırakılmalı
+    pub const PRESSURE_CRITICAL: u32 = 3; // OutOfMemory yakın
+
+    /// (Yeni) Poll edilebilir bir bellek baskısı Handle'ı açar.
+    /// Seviye değişip `min_level` veya üzerine çıktığında (ve tekrar indiğinde) handle
+    /// `poll::PollEventFlags::READABLE` olur; anlık seviye `read_pressure_level` ile okunur.
+    pub fn pressure_open(min_level: u32) -> Result<Handle, SahneError> {
+        if min_level == PRESSURE_NONE || min_level > PRESSURE_CRITICAL {
+            return Err(SahneError::InvalidParameter);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_MEM_PRESSURE_OPEN, min_level as u64, 0, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(Handle(result as u64))
+        }
+    }
+
+    /// (Yeni) Bellek baskısı handle'ından anlık seviyeyi (PRESSURE_*) okur.
+    pub fn read_pressure_level(handle: Handle) -> Result<u32, SahneError> {
+        let mut buf = [0u8; 4];
+        let n = resource::read(handle, &mut buf)?;
+        if n != buf.len() {
+            return Err(SahneError::InvalidOperation);
+        }
+        Ok(u32::from_le_bytes(buf))
+    }
+
+    /// (Yeni) Paylaşımlı bellek nesnesi için açılmış tüm izleme handle'larını (`watch_shared`) uyandırır.
+    /// `value` izleme handle'larından `read_watch` ile okunur. İzleyici sayısından bağımsız olarak tek çağrıdır.
+    pub fn notify_shared(handle: Handle, value: u64) -> Result<(), SahneError> {
+        if !handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_SHARED_MEM_NOTIFY, handle.raw(), value, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(())
+        }
+    }
+
+    /// (Yeni) Paylaşımlı bellek nesnesi için poll edilebilir bir izleme Handle'ı açar.
+    /// `notify_shared` sonrası handle `poll::PollEventFlags::READABLE` olur; `read_watch` hazır durumu temizler.
+    pub fn watch_shared(handle: Handle) -> Result<Handle, SahneError> {
+        if !handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_SHARED_MEM_WATCH, handle.raw(), 0, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(Handle(result as u64))
+        }
+    }
+
+    /// (Yeni) Eşlenmiş bir bellek aralığı için erişim biçimini bildirir (`resource::ADVICE_*`).
+    /// `addr` sayfa sınırına hizalı olmalıdır; `size` çekirdek tarafından sayfa sınırına yukarı yuvarlanır.
+    pub fn advise(addr: NonNull<u8>, size: usize, advice: u32) -> Result<(), SahneError> {
+        if advice > resource::ADVICE_HUGEPAGE {
+            return Err(SahneError::InvalidParameter);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_MEM_ADVISE, addr.as_ptr() as u64, size as u64, advice as u64, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(())
+        }
+    }
+
+    /// (Yeni) İzleme handle'ından son bildirilen değeri okur ve hazır durumunu temizler.
+    pub fn read_watch(watch: Handle) -> Result<u64, SahneError> {
+        let mut buf = [0u8; 8];
+        let n = resource::read(watch, &mut buf)?;
+        if n != buf.len() {
+            return Err(SahneError::InvalidOperation);
+        }
+        Ok(u64::from_le_bytes(buf))
+    }
 }
 
 // Görev (Task) yönetimi modülü (Süreç yerine)
@@ -261,7 +382,8 @@ pub mod task {
     /// * `code_handle`: Çalıştırılacak kodu içeren kaynağın Handle'ı.
     /// * `args`: Göreve başlangıçta iletilecek argüman verisi (genellikle ana fonksiyona geçirilir).
     /// * `initial_handles`: (Yeni Özellik) Yeni göreve başlangıçta verilecek Handle'ların listesi (örn. stdin/stdout).
-    ///    Bu Handle'lar çekirdek tarafından yeni görevin handle tablosuna kopyalanır.
+    ///    Bu Handle'lar, kanal üzerinden handle aktarımıyla aynı kurala göre yeni görevin handle tablosuna taşınır;
+    ///    yeni görev bunları `initial_handles()` ile aynı sırada alır.
     ///    syscall argüman sınırlaması nedeniyle bu Handle'lar başka bir kaynak (örn. paylaşımlı bellek) üzerinden geçirilebilir veya
     ///    farklı bir syscall/mekanizma kullanılabilir. Basitlik için argüman olarak ekleyelim, syscall'da nasıl ele alınacağı çekirdeğe bağlı.
     pub fn spawn(code_handle: Handle, args: &[u8], initial_handles: &[Handle]) -> Result<TaskId, SahneError> {
@@ -289,6 +411,73 @@ pub mod task {
         }
     }
 
+    /// (Yeni Özellik) Bir görev şablonu oluşturur.
+    /// Kod normal `spawn` gibi başlatılır; görev ilklendirmesini bitirip `template_checkpoint` çağırdığında
+    /// imajı dondurulur ve şablon olarak saklanır (bu çağrı o ana kadar bloklar).
+    /// Başarı durumunda şablon Handle'ı döner; `resource::release` ile bırakılır.
+    pub fn template_create(code_handle: Handle, args: &[u8], initial_handles: &[Handle]) -> Result<Handle, SahneError> {
+        if !code_handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_TASK_TEMPLATE_CREATE, code_handle.raw(),
+                    args.as_ptr() as u64, args.len() as u64,
+                    initial_handles.as_ptr() as u64, initial_handles.len() as u64)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result)) // Hata (örn. TaskCreationFailed görev checkpoint'e ulaşmadan sonlandı)
+        } else {
+            Ok(Handle(result as u64))
+        }
+    }
+
+    /// (Yeni Özellik) Şablon ilklendirmesinin bittiği noktayı işaretler.
+    /// Şablon oluşturan çalışmada bu fonksiyon geri dönmez (görev dondurulur).
+    /// Şablondan üretilen her klon yürütmeye buradan devam eder; klonun argümanları `args_buf`'a kopyalanır
+    /// ve argüman uzunluğu döner. Klonun başlangıç handle'ları `initial_handles()` ile alınır.
+    pub fn template_checkpoint(args_buf: &mut [u8]) -> Result<usize, SahneError> {
+        let result = unsafe {
+            syscall(arch::SYSCALL_TASK_TEMPLATE_CHECKPOINT, args_buf.as_mut_ptr() as u64, args_buf.len() as u64, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result)) // Hata (örn. InvalidOperation şablon dışında çağrıldı)
+        } else {
+            Ok(result as usize)
+        }
+    }
+
+    /// (Yeni Özellik) Bir şablondan copy-on-write klon olarak yeni görev başlatır.
+    /// Kod yükleme ve ilklendirme maliyeti ödenmez; `initial_handles` `spawn` ile aynı kurallarla taşınır.
+    pub fn spawn_from_template(template_handle: Handle, args: &[u8], initial_handles: &[Handle]) -> Result<TaskId, SahneError> {
+        if !template_handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_TASK_SPAWN_FROM_TEMPLATE, template_handle.raw(),
+                    args.as_ptr() as u64, args.len() as u64,
+                    initial_handles.as_ptr() as u64, initial_handles.len() as u64)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(TaskId(result as u64))
+        }
+    }
+
+    /// (Yeni Özellik) Mevcut göreve `spawn` ile verilen başlangıç handle'larını `out`'a yazar.
+    /// Başarı durumunda toplam başlangıç handle sayısını döner; bu değer `out.len()`'den büyükse
+    /// yalnızca ilk `out.len()` tanesi yazılmıştır. Geleneksel olarak ilk handle ebeveyn kanalıdır.
+    pub fn initial_handles(out: &mut [Handle]) -> Result<usize, SahneError> {
+        let result = unsafe {
+            syscall(arch::SYSCALL_TASK_GET_INITIAL_HANDLES, out.as_mut_ptr() as u64, out.len() as u64, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(result as usize)
+        }
+    }
+
     /// Mevcut görevi belirtilen çıkış koduyla sonlandırır. Bu fonksiyon geri dönmez.
     pub fn exit(code: i32) -> ! {
         unsafe {
@@ -312,12 +501,12 @@ pub mod task {
     }
 
     /// Mevcut görevi belirtilen süre kadar uyutur.
-    /// duration: Uyutulacak süre. Çekirdek hassasiyeti desteklemeyebilir.
+    /// duration: Uyutulacak süre. Çekirdek saat çözünürlüğüne yuvarlanabilir.
     pub fn sleep(duration: Duration) -> Result<(), SahneError> {
-        let milliseconds = duration.as_millis(); // Süreyi milisaniyeye çevir
-        // Çekirdeğin u64 milisaniye kabul ettiği varsayılır. Daha yüksek hassasiyet gerekirse ABI değişir.
+        // Nanosaniye ABI'si kullanılır; milisaniyeye çevirmek 1 ms altındaki süreleri 0'a (uyumamaya) kırpıyordu.
+        let nanoseconds = duration.as_nanos().min(u64::MAX as u128) as u64;
         let result = unsafe {
-            syscall(arch::SYSCALL_TASK_SLEEP, milliseconds as u64, 0, 0, 0, 0)
+            syscall(arch::SYSCALL_TASK_SLEEP_NS, nanoseconds, 0, 0, 0, 0)
         };
         if result < 0 {
             Err(map_kernel_error(result))
@@ -387,6 +576,73 @@ pub mod task {
              Ok(result as i32)
         }
     }
+
+    // (Yeni Özellik) wait_many bayrakları (sahne.h SAHNE_TASK_WAIT_*)
+    pub const WAIT_ANY: u32 = 0;           // En az bir görev sonlanınca dön
+    pub const WAIT_ALL: u32 = 1 << 0;      // Listedeki tüm görevler sonlanınca dön
+    pub const WAIT_CHILDREN: u32 = 1 << 1; // Liste yerine çağıranın tüm çocuklarını bekle
+
+    /// (Yeni Özellik) Sonlanan bir görevin ID'si ve çıkış kodu (sahne.h TaskExitStatus_t).
+    #[derive(Debug, Copy, Clone, PartialEq, Eq)]
+    #[repr(C)]
+    pub struct TaskExitStatus {
+        pub task_id: TaskId,
+        pub exit_code: i32,
+        pub reserved: u32,
+    }
+
+    impl TaskExitStatus {
+        pub const fn empty() -> Self {
+            TaskExitStatus { task_id: TaskId::invalid(), exit_code: 0, reserved: 0 }
+        }
+    }
+
+    /// (Yeni Özellik) Bir görev için poll edilebilir Handle edinir.
+    /// Görev sonlandığında handle `poll::PollEventFlags::TASK_EXITED` üretir; kanallarla aynı poll kümesinde beklenebilir.
+    pub fn open(task_id: TaskId) -> Result<Handle, SahneError> {
+        if !task_id.is_valid() {
+            return Err(SahneError::InvalidParameter);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_TASK_OPEN, task_id.raw(), 0, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(Handle(result as u64))
+        }
+    }
+
+    /// (Yeni Özellik) Birden çok görevin sonlanmasını tek sistem çağrısıyla bekler.
+    /// `task_ids`: Beklenecek görevler (`WAIT_CHILDREN` ile boş olabilir).
+    /// `results`: Sonlanan görevlerin yazılacağı dizi; `WAIT_CHILDREN` dışında en az `task_ids.len()` olmalıdır.
+    /// `timeout`: None sonsuz bekleme. Çekirdeğe milisaniyeye yukarı yuvarlanarak geçer.
+    ///    Süre dolarsa o ana kadar sonlananlar döner (0 olabilir).
+    /// Başarı durumunda `results`'a yazılan (toplanan) görev sayısını döner.
+    pub fn wait_many(task_ids: &[TaskId], flags: u32, timeout: Option<Duration>, results: &mut [TaskExitStatus]) -> Result<usize, SahneError> {
+        let count = if flags & WAIT_CHILDREN != 0 {
+            results.len()
+        } else {
+            if results.len() < task_ids.len() || task_ids.iter().any(|t| !t.is_valid()) {
+                return Err(SahneError::InvalidParameter);
+            }
+            task_ids.len()
+        };
+        let timeout_ms = match timeout {
+            // Yukarı yuvarla (ms altı süre bloklamayan yoklamaya dönüşmesin) ve i64::MAX'ta doyur
+            Some(d) => ((d.as_nanos() + 999_999) / 1_000_000).min(i64::MAX as u128) as i64,
+            None => -1,
+        };
+        let result = unsafe {
+            syscall(arch::SYSCALL_TASK_WAIT_MANY, task_ids.as_ptr() as u64, count as u64,
+                    flags as u64, timeout_ms as u64, results.as_mut_ptr() as u64)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(result as usize)
+        }
+    }
 }
 
 // Kaynak yönetimi modülü (Dosya sistemi yerine, Seek ve Stat eklendi)
@@ -527,7 +783,7 @@ pub mod resource {
     pub struct ResourceStatus {
         pub size: u64,       // Kaynak boyutu (dosya boyutu gibi)
         pub type_flags: u32, // Kaynak tipi ve özellik bayrakları (dosya, cihaz, pipe, socket vb.)
-        pub link_count: u62, // Kaynağa bağlı link sayısı (filesystemler için)
+        pub link_count: u32, // Kaynağa bağlı link sayısı (filesystemler için)
         pub reserved: u32,   // Hizalanma veya gelecekte kullanım için
         // TODO: Erişim zamanları, izinler gibi diğer stat bilgileri
     }
@@ -553,6 +809,238 @@ pub mod resource {
             Ok(())
         }
     }
+
+    // (Yeni) ResourceStatus::type_flags içindeki kaynak tipi (alt 8 bit, sahne.h SAHNE_RESOURCE_TYPE_*)
+    pub const RESOURCE_TYPE_MASK: u32 = 0xFF;
+    pub const RESOURCE_TYPE_FILE: u32 = 1;
+    pub const RESOURCE_TYPE_DIRECTORY: u32 = 2;
+    pub const RESOURCE_TYPE_DEVICE: u32 = 3;
+
+    /// (Yeni) `enumerate` için ilk çerez değeri
+    pub const ENUM_COOKIE_START: u64 = 0;
+    /// (Yeni) Kayıt hizalaması (sahne.h SAHNE_DIR_ENTRY_ALIGN)
+    pub const DIR_ENTRY_ALIGN: usize = 8;
+
+    /// (Yeni) `enumerate` tamponundaki kayıt başlığı (sahne.h DirEntry_t ile aynı düzen).
+    /// Başlığın hemen ardından `name_len` byte isim gelir; sonraki kayıt `record_len` byte sonradır.
+    #[derive(Debug, Copy, Clone, PartialEq, Eq)]
+    #[repr(C)]
+    pub struct DirEntryHeader {
+        pub record_len: u32,
+        pub name_len: u16,
+        pub reserved: u16,
+        pub cookie: u64,             // Bu kayıttan sonrasına devam etmek için çerez
+        pub status: ResourceStatus,  // stat ile aynı bilgiler
+    }
+
+    /// (Yeni) Bir dizin girdisi (isim, tamponu ödünç alır).
+    #[derive(Debug, Copy, Clone)]
+    pub struct DirEntry<'a> {
+        pub name: &'a [u8],
+        pub cookie: u64,
+        pub status: ResourceStatus,
+    }
+
+    impl<'a> DirEntry<'a> {
+        pub fn is_directory(&self) -> bool {
+            self.status.type_flags & RESOURCE_TYPE_MASK == RESOURCE_TYPE_DIRECTORY
+        }
+    }
+
+    /// (Yeni) Dizin girdilerini tampona sığdığı kadar, durum bilgisiyle birlikte tek çağrıda listeler.
+    /// `cookie`: ilk çağrıda ENUM_COOKIE_START; başarıda son yazılan kaydın çerezine güncellenir.
+    /// Yazılan kayıt sayısını döner; 0 dizinin sonu demektir. Kayıtlar `DirEntries` ile gezilir.
+    pub fn enumerate(dir_handle: Handle, buffer: &mut [u8], cookie: &mut u64) -> Result<usize, SahneError> {
+        if !dir_handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_RESOURCE_ENUMERATE, dir_handle.raw(), buffer.as_mut_ptr() as u64,
+                    buffer.len() as u64, cookie as *mut u64 as u64, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(result as usize)
+        }
+    }
+
+    /// (Yeni) `enumerate` ile doldurulmuş tampondaki kayıtlar üzerinde gezinir.
+    /// Bozuk bir kayıtta gezinme biter ve `error()` CommunicationError döner (C++ for_each_entry ile aynı).
+    pub struct DirEntries<'a> {
+        buffer: &'a [u8],
+        offset: usize,
+        remaining: usize,
+        corrupt: bool,
+    }
+
+    impl<'a> DirEntries<'a> {
+        /// `count`: enumerate'in döndürdüğü kayıt sayısı.
+        pub fn new(buffer: &'a [u8], count: usize) -> Self {
+            DirEntries { buffer, offset: 0, remaining: count, corrupt: false }
+        }
+
+        /// Gezinme bozuk bir kayıt yüzünden bittiyse hatayı döner; temiz bitişte None.
+        pub fn error(&self) -> Option<SahneError> {
+            if self.corrupt { Some(SahneError::CommunicationError) } else { None }
+        }
+    }
+
+    impl<'a> Iterator for DirEntries<'a> {
+        type Item = DirEntry<'a>;
+
+        fn next(&mut self) -> Option<DirEntry<'a>> {
+            let header_size = core::mem::size_of::<DirEntryHeader>();
+            if self.remaining == 0 {
+                return None;
+            }
+            if self.offset + header_size > self.buffer.len() {
+                self.remaining = 0; // Sayılan kayıtlar tampona sığmıyor
+                self.corrupt = true;
+                return None;
+            }
+            // Tampon hizası çağırana bağlı olduğundan hizasız okunur
+            let header = unsafe {
+                core::ptr::read_unaligned(self.buffer.as_ptr().add(self.offset) as *const DirEntryHeader)
+            };
+            let name_start = self.offset + header_size;
+            let name_end = name_start + header.name_len as usize;
+            // Kayıt en az başlık + isim kadar olmalı; yoksa sonraki kayıt ismin üzerine biner
+            if name_end > self.buffer.len() || (header.record_len as usize) < header_size + header.name_len as usize {
+                self.remaining = 0; // Bozuk kayıt: gezinmeyi bitir ve error() ile bildir
+                self.corrupt = true;
+                return None;
+            }
+            self.offset += header.record_len as usize;
+            self.remaining -= 1;
+            Some(DirEntry { name: &self.buffer[name_start..name_end], cookie: header.cookie, status: header.status })
+        }
+    }
+
+    /// (Yeni) `copy_range` ofseti: handle'ın mevcut konumu kullanılır ve ilerletilir (sahne.h SAHNE_COPY_OFFSET_CURRENT)
+    pub const COPY_OFFSET_CURRENT: u64 = u64::MAX;
+
+    /// (Yeni) `src` kaynağından `dst` kaynağına/kanalına en fazla `len` byte'ı çekirdek içinde kopyalar.
+    /// Ofsetler `None` ise handle'ın mevcut konumu kullanılır. Kopyalanan byte sayısını döner
+    /// (kısa olabilir; 0 kaynağın sonu demektir).
+    pub fn copy_range(src: Handle, src_offset: Option<u64>, dst: Handle, dst_offset: Option<u64>, len: u64) -> Result<u64, SahneError> {
+        if !src.is_valid() || !dst.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_RESOURCE_COPY_RANGE, src.raw(), src_offset.unwrap_or(COPY_OFFSET_CURRENT),
+                    dst.raw(), dst_offset.unwrap_or(COPY_OFFSET_CURRENT), len)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(result as u64)
+        }
+    }
+
+    /// (Yeni) `copy_range`'i kısa kopyalar için `len` byte tamamlanana veya kaynak bitene kadar tekrarlar.
+    /// Açık ofsetler her adımda ilerletilir. Toplam kopyalanan byte sayısını döner.
+    /// C++ sahne::resource::copy_all'dan farklı olarak okuma/yazma geri dönüşü yoktur (tampon ayrılmaz):
+    /// çekirdek desteklemiyorsa NotSupported döner ve geri dönüşü çağıran seçer.
+    pub fn copy_all(src: Handle, mut src_offset: Option<u64>, dst: Handle, mut dst_offset: Option<u64>, len: u64) -> Result<u64, SahneError> {
+        let mut total = 0u64;
+        while total < len {
+            let copied = copy_range(src, src_offset, dst, dst_offset, len - total)?;
+            if copied == 0 {
+                break; // Kaynağın sonu
+            }
+            total += copied;
+            src_offset = src_offset.map(|o| o + copied);
+            dst_offset = dst_offset.map(|o| o + copied);
+        }
+        Ok(total)
+    }
+
+    // (Yeni) `sync` bayrakları (sahne.h SAHNE_SYNC_*)
+    pub const SYNC_FLUSH: u32 = 0;         // Cihaza göndermeyi başlat, bekleme
+    pub const SYNC_DATA: u32 = 1 << 0;     // Veri kalıcı olana kadar bekle
+    pub const SYNC_METADATA: u32 = 1 << 1; // Tüm meta veriyi de kalıcı yap
+
+    /// (Yeni) Kaynağa yapılmış yazmaları cihaza gönderir; `flags` SYNC_DATA/SYNC_METADATA içeriyorsa
+    /// kalıcı olana kadar bekler. Başarıda, çağrıdan önce tamamlanmış tüm yazmalar kalıcıdır.
+    pub fn sync(handle: Handle, flags: u32) -> Result<(), SahneError> {
+        if !handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_RESOURCE_SYNC, handle.raw(), flags as u64, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(())
+        }
+    }
+
+    /// (Yeni) Yazmaları cihaza göndermeyi başlatır (kalıcılığı beklemez).
+    pub fn flush(handle: Handle) -> Result<(), SahneError> {
+        sync(handle, SYNC_FLUSH)
+    }
+
+    // (Yeni) Erişim tavsiyeleri (sahne.h SAHNE_ADVICE_*); `advise` ve `memory::advise` için ortak
+    pub const ADVICE_NORMAL: u32 = 0;
+    pub const ADVICE_SEQUENTIAL: u32 = 1; // Agresif read-ahead
+    pub const ADVICE_RANDOM: u32 = 2;     // Read-ahead kapalı
+    pub const ADVICE_WILLNEED: u32 = 3;   // Arka planda belleğe getir
+    pub const ADVICE_DONTNEED: u32 = 4;   // Önce bunları tahliye et
+    pub const ADVICE_HUGEPAGE: u32 = 5;   // Büyük sayfa (yalnızca memory::advise)
+    pub const ADVISE_TO_END: u64 = 0;     // `len` için "kaynağın sonuna kadar"
+
+    /// (Yeni) Kaynağın `offset..offset+len` aralığı için erişim biçimini bildirir.
+    /// Yalnızca performansı etkiler; desteklenmeyen kaynaklarda NotSupported döner ve yok sayılabilir.
+    pub fn advise(handle: Handle, offset: u64, len: u64, advice: u32) -> Result<(), SahneError> {
+        if !handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        if advice > ADVICE_DONTNEED {
+            return Err(SahneError::InvalidParameter);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_RESOURCE_ADVISE, handle.raw(), offset, len, advice as u64, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(())
+        }
+    }
+
+    /// (Yeni) Aralığı arka planda belleğe getirmeye başlar ve hemen döner (`advise(.., ADVICE_WILLNEED)`).
+    pub fn prefetch(handle: Handle, offset: u64, len: u64) -> Result<(), SahneError> {
+        advise(handle, offset, len, ADVICE_WILLNEED)
+    }
+
+    // (Yeni) Yayınlanan kaynaklara gelen istek metodları (sahne.h SAHNE_RESOURCE_METHOD_*)
+    pub const METHOD_READ: u32 = 1;
+
+    /// (Yeni) METHOD_READ isteğinin verisi (sahne.h SahneResourceReadRequest_t); ardından `path_len` byte alt yol gelir.
+    #[repr(C)]
+    #[derive(Debug, Copy, Clone, PartialEq, Eq)]
+    pub struct ReadRequest {
+        pub offset: u64,
+        pub max_len: u32,
+        pub path_len: u32,
+    }
+
+    /// (Yeni) Bu görevin sunacağı bir kaynak adı yayınlar ve isteklerin geleceği kanal Handle'ını döner.
+    /// Başka bir görev adı (veya "<ad>/<alt yol>") okuduğunda kanala bir rpc isteği (method = METHOD_READ,
+    /// veri = ReadRequest + alt yol) gelir; rpc yanıtının verisi okuyucunun tamponuna kopyalanır.
+    /// Kanal Handle'ı bırakıldığında ad kaldırılır.
+    pub fn publish(name: ResourceId) -> Result<Handle, SahneError> {
+        let result = unsafe {
+            syscall(arch::SYSCALL_RESOURCE_PUBLISH, name.as_ptr() as u64, name.len() as u64, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(Handle(result as u64))
+        }
+    }
 }
 
 // Çekirdek ile genel etkileşim modülü (Daha fazla info türü eklenebilir)
@@ -567,6 +1055,15 @@ pub mod kernel {
     pub const KERNEL_INFO_ARCHITECTURE: u32 = 5;   // Çalışan mimari (örn. ARCH_X86_64 sabiti dönebilir)
     pub const KERNEL_INFO_TOTAL_MEMORY_BYTES: u32 = 6; // (Yeni) Toplam fiziksel bellek
     pub const KERNEL_INFO_FREE_MEMORY_BYTES: u32 = 7;  // (Yeni) Boş fiziksel bellek
+    pub const KERNEL_INFO_CPU_FEATURES: u32 = 8;       // (Yeni) CPU_FEATURE_* bit maskesi
+
+    // (Yeni) KERNEL_INFO_CPU_FEATURES bitleri (sahne.h SAHNE_CPU_FEATURE_*)
+    pub const CPU_FEATURE_SSE42: u64 = 1 << 0;
+    pub const CPU_FEATURE_PCLMULQDQ: u64 = 1 << 1;
+    pub const CPU_FEATURE_AVX2: u64 = 1 << 2;
+    pub const CPU_FEATURE_AVX512F: u64 = 1 << 3;
+    pub const CPU_FEATURE_NEON: u64 = 1 << 4;
+    pub const CPU_FEATURE_ARM_CRC32: u64 = 1 << 5;
     // ... diğer Sahne64'e özgü kernel bilgileri
 
     /// Çekirdekten belirli bir bilgiyi alır.
@@ -592,6 +1089,51 @@ pub mod kernel {
               Ok(result as u64) // Başarı durumunda zaman değeri döner (u64)
           }
     }
+
+    /// (Yeni) `get_stats` yapı sürümü (sahne.h SAHNE_KERNEL_STATS_VERSION)
+    pub const KERNEL_STATS_VERSION: u32 = 1;
+
+    /// (Yeni) Tek çağrıda alınan çekirdek ve görev istatistikleri (sahne.h KernelStats_t ile aynı düzen).
+    /// Çekirdek en fazla `size` byte doldurur; eski bir çekirdeğin bilmediği alanlar 0 kalır.
+    #[repr(C)]
+    #[derive(Debug, Copy, Clone, Default, PartialEq, Eq)]
+    pub struct KernelStats {
+        pub version: u32,
+        pub size: u32,
+        // KERNEL_INFO_* anahtarlarının karşılıkları
+        pub version_major: u64,
+        pub version_minor: u64,
+        pub build_id: u64,
+        pub uptime_seconds: u64,
+        pub architecture: u64,
+        pub total_memory_bytes: u64,
+        pub free_memory_bytes: u64,
+        pub memory_pressure: u32, // Anlık memory::PRESSURE_* seviyesi
+        pub reserved: u32,
+        // Çağıran göreve ait değerler
+        pub task_memory_bytes: u64,
+        pub task_handle_count: u64,
+        pub task_cpu_time_ns: u64,
+    }
+
+    /// (Yeni) Tüm kernel bilgilerini ve çağıran görevin bellek/handle/CPU kullanımını
+    /// tek sistem çağrısıyla tutarlı bir anlık görüntü olarak alır.
+    pub fn get_stats() -> Result<KernelStats, SahneError> {
+        let mut stats = KernelStats {
+            version: KERNEL_STATS_VERSION,
+            size: core::mem::size_of::<KernelStats>() as u32,
+            ..KernelStats::default()
+        };
+        let result = unsafe {
+            syscall(arch::SYSCALL_KERNEL_GET_STATS, &mut stats as *mut KernelStats as u64,
+                    core::mem::size_of::<KernelStats>() as u64, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(stats)
+        }
+    }
 }
 
 // Senkronizasyon araçları modülü (Mutex -> Lock)
@@ -669,6 +1211,21 @@ pub mod messaging {
         }
     }
 
+    /// (Yeni Özellik) Birbirine bağlı iki kanal ucu oluşturur.
+    /// Bir uçtan gönderilen mesajlar diğer uçtan alınır. Uçlardan biri `task::spawn` initial_handles veya
+    /// `send_with_handles` ile başka bir göreve devredilebilir.
+    pub fn create_channel_pair() -> Result<(Handle, Handle), SahneError> {
+        let mut pair = [Handle::invalid(); 2];
+        let result = unsafe {
+            syscall(arch::SYSCALL_CHANNEL_CREATE_PAIR, pair.as_mut_ptr() as u64, 0, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok((pair[0], pair[1]))
+        }
+    }
+
     /// (Yeni Özellik) Mevcut bir mesaj kanalına ResourceId'si (veya Handle'ı) üzerinden bağlanır.
     /// `channel_id`: Kanalı tanımlayan ResourceId veya başka bir tanımlayıcı.
     /// Başarı durumunda kanalın diğer ucuna erişim sağlayan bir Handle döner.
@@ -729,90 +1286,1901 @@ pub mod messaging {
         }
     }
 
-    // Eski, doğrudan Task ID'ye mesaj gönderme fonksiyonları da kalabilir veya kaldırılabilir.
-     Pub fn send(...)
-     Pub fn receive(...) // Bu fonksiyon muhtemelen mevcut görevin varsayılan mesaj kuyruğuna bağlıdır.
-    // Yeni channel API'sı daha genel ve esnektir.
-}
+    // (Yeni Özellik) Toplu gönderim/alım çerçeve formatı (sahne.h SAHNE_CHANNEL_FRAME_* ile aynı)
+    // Her mesaj [u32 uzunluk (little-endian)][veri][dolgu] olarak dizilir, çerçeveler FRAME_ALIGN'a hizalanır.
+    pub const FRAME_HEADER_SIZE: usize = 4;
+    pub const FRAME_ALIGN: usize = 8;
 
-// Yeni bir modül: Polling ve Olay Yönetimi
-// Birden çok handle üzerinde eşzamanlı olarak olay (okuma, yazma, bağlantı kesilmesi vb.) bekleme mekanizması.
-pub mod poll {
-    use super::{SahneError, arch, syscall, map_kernel_error, map_kernel_ok_result, Handle};
-    use core::time::Duration;
+    /// `len` byte'lık bir mesajın tampon içinde kapladığı toplam çerçeve boyutu.
+    pub const fn frame_size(len: usize) -> usize {
+        (FRAME_HEADER_SIZE + len + (FRAME_ALIGN - 1)) & !(FRAME_ALIGN - 1)
+    }
 
-    // Beklenecek ve dönecek olay türleri bayrakları
-    #[derive(Debug, Copy, Clone, PartialEq, Eq)]
-    #[repr(u32)] // Çekirdeğe u32 olarak gönderilir/alınır
-    pub enum PollEventFlags {
-        NONE = 0,
-        READABLE = 1 << 0,  // Okunmaya hazır (veri var veya bağlantı kapandı)
-        WRITABLE = 1 << 1,  // Yazmaya hazır (buffer'da yer var)
-        ERROR = 1 << 2,     // Hata durumu
-        DISCONNECTED = 1 << 3, // Bağlantı kesildi
-        // TODO: Diğer olay türleri (kilit açıldı, görev sonlandı vb.)
+    /// (Yeni Özellik) receive_many tarafından doldurulan mesaj konumu (sahne.h MessageSpan_t).
+    #[derive(Debug, Copy, Clone, PartialEq, Eq, Default)]
+    #[repr(C)]
+    pub struct MessageSpan {
+        pub offset: u32, // Mesaj verisinin tampon başından ofseti
+        pub len: u32,    // Mesaj verisinin uzunluğu
     }
 
-    impl core::ops::BitOr for PollEventFlags {
-        type Output = Self;
-        fn bitor(self, other: Self) -> Self {
-            unsafe { core::mem::transmute(self as u32 | other as u32) }
+    impl MessageSpan {
+        /// Span'in gösterdiği mesaj verisini tampondan döner.
+        pub fn data<'a>(&self, buffer: &'a [u8]) -> &'a [u8] {
+            let start = self.offset as usize;
+            &buffer[start..start + self.len as usize]
         }
     }
 
-    impl core::ops::BitAnd for PollEventFlags {
-         type Output = Self;
-        fn bitand(self, other: Self) -> Self {
-            unsafe { core::mem::transmute(self as u32 & other as u32) }
-        }
+    /// (Yeni Özellik) Kullanıcının verdiği tampon üzerine çerçeve dizen yardımcı.
+    /// Heap kullanmaz; tampon dolduğunda `push` ResourceBusy döner ve biriken çerçeveler gönderilebilir.
+    pub struct FrameWriter<'a> {
+        buffer: &'a mut [u8],
+        used: usize,
+        count: usize,
     }
 
-     impl core::ops::BitOrAssign for PollEventFlags {
-        fn bitor_assign(&mut self, other: Self) {
-            *self = *self | other;
+    impl<'a> FrameWriter<'a> {
+        pub fn new(buffer: &'a mut [u8]) -> Self {
+            FrameWriter { buffer, used: 0, count: 0 }
         }
-    }
 
-     impl core::ops::BitAndAssign for PollEventFlags {
-         fn bitand_assign(&mut self, other: Self) {
+        /// Bir mesajı sonraki çerçeveye kopyalar.
+        pub fn push(&mut self, message: &[u8]) -> Result<(), SahneError> {
+            if message.len() > u32::MAX as usize {
+                return Err(SahneError::InvalidParameter);
+            }
+            let size = frame_size(message.len());
+            if self.buffer.len() - self.used < size {
+                return Err(SahneError::ResourceBusy); // Tampon dolu, önce flush edilmeli
+            }
+            let frame = &mut self.buffer[self.used..self.used + size];
+            frame[..FRAME_HEADER_SIZE].copy_from_slice(&(message.len() as u32).to_le_bytes());
+            frame[FRAME_HEADER_SIZE..FRAME_HEADER_SIZE + message.len()].copy_from_slice(message);
+            for b in &mut frame[FRAME_HEADER_SIZE + message.len()..] {
+                *b = 0;
+            }
+            self.used += size;
+            self.count += 1;
+            Ok(())
+        }
+
+        /// Dizilen çerçevelerin tamamı (send_many'ye verilecek kısım).
+        pub fn frames(&self) -> &[u8] {
+            &self.buffer[..self.used]
+        }
+
+        pub fn count(&self) -> usize {
+            self.count
+        }
+
+        pub fn is_empty(&self) -> bool {
+            self.count == 0
+        }
+
+        /// Yazıcıyı boşaltır (tampon yeniden kullanılabilir).
+        pub fn clear(&mut self) {
+            self.used = 0;
+            self.count = 0;
+        }
+
+        /// Biriken çerçeveleri kanala gönderir. Kanal yalnızca bir kısmını kabul ederse,
+        /// gönderilmeyen çerçeveler tamponun başına taşınır ve gönderilen sayı döner.
+        pub fn flush(&mut self, channel_handle: Handle) -> Result<usize, SahneError> {
+            if self.is_empty() {
+                return Ok(0);
+            }
+            let sent = send_many(channel_handle, self.frames())?;
+            if sent >= self.count {
+                self.clear();
+                return Ok(sent);
+            }
+            // Gönderilen çerçevelerin toplam boyutunu bul ve kalanları başa kaydır
+            let mut consumed = 0;
+            for _ in 0..sent {
+                let mut len_bytes = [0u8; FRAME_HEADER_SIZE];
+                len_bytes.copy_from_slice(&self.buffer[consumed..consumed + FRAME_HEADER_SIZE]);
+                consumed += frame_size(u32::from_le_bytes(len_bytes) as usize);
+            }
+            self.buffer.copy_within(consumed..self.used, 0);
+            self.used -= consumed;
+            self.count -= sent;
+            Ok(sent)
+        }
+    }
+
+    /// (Yeni Özellik) Çerçevelenmiş birden çok mesajı tek sistem çağrısıyla gönderir.
+    /// `frames`: FRAME_* formatında dizilmiş mesajlar (bkz. FrameWriter).
+    /// Kanal dolarsa yalnızca sığan çerçeveler gönderilir; başarı durumunda gönderilen mesaj sayısını döner.
+    pub fn send_many(channel_handle: Handle, frames: &[u8]) -> Result<usize, SahneError> {
+        if !channel_handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        if frames.is_empty() {
+            return Ok(0);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_CHANNEL_SEND_MANY, channel_handle.raw(), frames.as_ptr() as u64, frames.len() as u64, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result)) // Hata (örn. WouldBlock, Disconnected, InvalidParameter bozuk çerçeve)
+        } else {
+            Ok(result as usize) // Başarı (gönderilen mesaj sayısı)
+        }
+    }
+
+    /// (Yeni Özellik) Kanaldaki mesajlardan `buffer`'a sığdığı kadarını tek sistem çağrısıyla alır.
+    /// Çekirdek çerçeveleri tampona yazar ve her mesaj için `spans`'e bir giriş doldurur.
+    /// Başarı durumunda alınan mesaj sayısını döner (`spans[..n]` geçerlidir).
+    pub fn receive_many(channel_handle: Handle, buffer: &mut [u8], spans: &mut [MessageSpan]) -> Result<usize, SahneError> {
+        if !channel_handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        if spans.is_empty() || buffer.len() > u32::MAX as usize {
+            return Err(SahneError::InvalidParameter); // Span ofsetleri u32, tampon 4 GiB'ı aşamaz
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_CHANNEL_RECEIVE_MANY, channel_handle.raw(),
+                    buffer.as_mut_ptr() as u64, buffer.len() as u64,
+                    spans.as_mut_ptr() as u64, spans.len() as u64)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result)) // Hata (örn. NoMessage, Disconnected, InvalidParameter)
+        } else {
+            Ok(result as usize) // Başarı (alınan mesaj sayısı)
+        }
+    }
+
+    /// Tek bir mesaja eklenebilecek en fazla handle sayısı (sahne.h SAHNE_CHANNEL_MAX_HANDLES).
+    pub const MAX_HANDLES_PER_MESSAGE: usize = 64;
+
+    // (Yeni Özellik) Handle'lı mesaj alımında çekirdeğe geçirilen zarf (sahne.h ChannelEnvelope_t).
+    #[derive(Debug)]
+    #[repr(C)]
+    pub struct Envelope {
+        pub data: *mut u8,
+        pub data_cap: usize,
+        pub data_len: usize,     // Çekirdek doldurur
+        pub handles: *mut Handle,
+        pub handles_cap: usize,
+        pub handles_len: usize,  // Çekirdek doldurur
+    }
+
+    /// (Yeni Özellik) Mesajla birlikte handle'ları kanal üzerinden aktarır.
+    /// Handle'lar gönderen görevden alıcıya taşınır (sahiplik devri); başarı sonrası gönderende geçersizdir.
+    /// Mevcut paylaşımlı bellek eşlemeleri geçerli kalır, bu sayede büyük bir tampon O(1) maliyetle devredilebilir.
+    /// Gönderim başarısız olursa handle'lar gönderende kalır.
+    pub fn send_with_handles(channel_handle: Handle, message: &[u8], handles: &[Handle]) -> Result<(), SahneError> {
+        if !channel_handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        if handles.len() > MAX_HANDLES_PER_MESSAGE {
+            return Err(SahneError::InvalidParameter);
+        }
+        if handles.iter().any(|h| !h.is_valid() || *h == channel_handle) {
+            return Err(SahneError::InvalidHandle); // Kanal kendi üzerinden gönderilemez
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_CHANNEL_SEND_HANDLES, channel_handle.raw(),
+                    message.as_ptr() as u64, message.len() as u64,
+                    handles.as_ptr() as u64, handles.len() as u64)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result)) // Hata (örn. WouldBlock, Disconnected, PermissionDenied aktarılamaz handle)
+        } else {
+            Ok(())
+        }
+    }
+
+    /// (Yeni Özellik) Kanaldan bir mesajı ve ona eklenmiş handle'ları alır.
+    /// Başarı durumunda (alınan byte sayısı, alınan handle sayısı) döner.
+    /// Alınan handle'lar çağıran görevindir; işi bitince `resource::release` ile bırakılmalıdır.
+    pub fn receive_with_handles(channel_handle: Handle, buffer: &mut [u8], handles: &mut [Handle]) -> Result<(usize, usize), SahneError> {
+        if !channel_handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        let mut envelope = Envelope {
+            data: buffer.as_mut_ptr(),
+            data_cap: buffer.len(),
+            data_len: 0,
+            handles: handles.as_mut_ptr(),
+            handles_cap: handles.len(),
+            handles_len: 0,
+        };
+        let result = unsafe {
+            syscall(arch::SYSCALL_CHANNEL_RECEIVE_HANDLES, channel_handle.raw(), &mut envelope as *mut Envelope as u64, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result)) // Hata (örn. NoMessage, InvalidParameter yetersiz kapasite)
+        } else {
+            Ok((envelope.data_len, envelope.handles_len))
+        }
+    }
+
+    /// (Yeni Özellik) Paylaşımlı bellek tamponunu kanal üzerinden devreder.
+    /// Mesaj gövdesi tampondaki geçerli veri uzunluğudur (u64 little-endian); veri kopyalanmaz.
+    pub fn send_shared_buffer(channel_handle: Handle, shared_handle: Handle, len: usize) -> Result<(), SahneError> {
+        let header = (len as u64).to_le_bytes();
+        send_with_handles(channel_handle, &header, &[shared_handle])
+    }
+
+    /// (Yeni Özellik) `send_shared_buffer` ile gönderilen bir tamponu alır.
+    /// Başarı durumunda (paylaşımlı bellek handle'ı, geçerli veri uzunluğu) döner; tampon `memory::map_shared` ile eşlenebilir.
+    pub fn receive_shared_buffer(channel_handle: Handle) -> Result<(Handle, usize), SahneError> {
+        let mut header = [0u8; 8];
+        let mut handles = [Handle::invalid(); 1];
+        let (bytes, count) = receive_with_handles(channel_handle, &mut header, &mut handles)?;
+        if bytes != header.len() || count != 1 {
+            // Beklenmeyen mesaj: aktarılan handle'ları sızdırma
+            for h in &handles[..count] {
+                let _ = resource::release(*h);
+            }
+            return Err(SahneError::CommunicationError);
+        }
+        Ok((handles[0], u64::from_le_bytes(header) as usize))
+    }
+
+    // Eski, doğrudan Task ID'ye mesaj gönderme fonksiyonları da kalabilir veya kaldırılabilir.
+     Pub fn send(...)
+     Pub fn receive(...) // Bu fonksiyon muhtemelen mevcut görevin varsayılan mesaj kuyruğuna bağlıdır.
+    // Yeni channel API'sı daha genel ve esnektir.
+}
+
+// Yeni bir modül: Polling ve Olay Yönetimi
+// Birden çok handle üzerinde eşzamanlı olarak olay (okuma, yazma, bağlantı kesilmesi vb.) bekleme mekanizması.
+pub mod poll {
+    use super::{SahneError, arch, syscall, map_kernel_error, map_kernel_ok_result, Handle};
+    use core::time::Duration;
+
+    // Beklenecek ve dönecek olay türleri bayrakları
+    #[derive(Debug, Copy, Clone, PartialEq, Eq)]
+    #[repr(u32)] // Çekirdeğe u32 olarak gönderilir/alınır
+    pub enum PollEventFlags {
+        NONE = 0,
+        READABLE = 1 << 0,  // Okunmaya hazır (veri var veya bağlantı kapandı)
+        WRITABLE = 1 << 1,  // Yazmaya hazır (buffer'da yer var)
+        ERROR = 1 << 2,     // Hata durumu
+        DISCONNECTED = 1 << 3, // Bağlantı kesildi
+        TASK_EXITED = 1 << 4,  // Görev sonlandı (task::open ile alınan görev handle'ları için)
+        // TODO: Diğer olay türleri (kilit açıldı vb.)
+    }
+
+    impl core::ops::BitOr for PollEventFlags {
+        type Output = Self;
+        fn bitor(self, other: Self) -> Self {
+            unsafe { core::mem::transmute(self as u32 | other as u32) }
+        }
+    }
+
+    impl core::ops::BitAnd for PollEventFlags {
+         type Output = Self;
+        fn bitand(self, other: Self) -> Self {
+            unsafe { core::mem::transmute(self as u32 & other as u32) }
+        }
+    }
+
+     impl core::ops::BitOrAssign for PollEventFlags {
+        fn bitor_assign(&mut self, other: Self) {
+            *self = *self | other;
+        }
+    }
+
+     impl core::ops::BitAndAssign for PollEventFlags {
+         fn bitand_assign(&mut self, other: Self) {
             *self = *self & other;
         }
-     }
+     }
+
+
+    /// (Yeni Özellik) PollEntry struct'ı: Poll çağrısı için tek bir handle girişi
+    #[derive(Debug, Copy, Clone, PartialEq, Eq)]
+    #[repr(C)] // C ABI uyumu (syscall ile array olarak geçecek)
+    pub struct PollEntry {
+        pub handle: Handle,         // Beklenecek handle
+        pub events_in: PollEventFlags, // Beklenen olaylar (input)
+        pub events_out: PollEventFlags, // Gerçekleşen olaylar (output, çekirdek doldurur)
+    }
+
+    /// (Yeni Özellik) Birden çok handle üzerinde belirli olayların gerçekleşmesini bekler.
+    /// `entries`: Beklenecek handle'lar ve beklenen olayları içeren PollEntry dizisi.
+    ///            Çekirdek bu diziyi güncelleyerek gerçekleşen olayları `events_out` alanına yazar.
+    /// `timeout`: Ne kadar bekleneceği. None ise sonsuza kadar bekler. Some(Duration) ise belirtilen süre kadar bekler (ns hassasiyetinde).
+    /// Zamanlayıcı handle'ları (`timer::create`) READABLE ile aynı kümeye eklenebilir.
+    /// Başarı durumunda, olay gerçekleşen (events_out != NONE) entry sayısını döner.
+    pub fn poll(entries: &mut [PollEntry], timeout: Option<Duration>) -> Result<usize, SahneError> {
+        let entries_ptr = entries.as_mut_ptr() as u64;
+        let entries_len = entries.len() as u64;
+        let timeout_ns = match timeout {
+            Some(d) => d.as_nanos().min(i64::MAX as u128) as i64, // ns olarak i64'e çevir (ms'ye kırpılmaz)
+            None => -1, // Sonsuz bekleme için özel değer (Unix poll'daki -1 gibi)
+        };
+
+        // Syscall argümanları (handle listesi pointer/uzunluk, timeout)
+        let result = unsafe {
+            syscall(arch::SYSCALL_POLL_NS, entries_ptr, entries_len, timeout_ns as u64, 0, 0)
+        };
+
+        if result < 0 {
+            Err(map_kernel_error(result)) // Hata (örn. Interrupted, InvalidArgument)
+        } else {
+            // Başarı durumunda, olay gerçekleşen entry sayısı döner.
+            // Çekirdek, `entries` dizisindeki `events_out` alanlarını doldurmuş olmalıdır.
+            Ok(result as usize)
+        }
+    }
+}
+
+// Yeni bir modül: Zamanlayıcılar (Timer) ve hiyerarşik zamanlayıcı çarkı (timer wheel)
+// Çekirdek zamanlayıcı handle'ları poll edilebilir (dolunca READABLE). TimerWheel, milyonlarca mantıksal
+// zamanlayıcıyı kullanıcı alanında tutar ve tek bir çekirdek zamanlayıcısını en yakın dolma zamanına kurar.
+pub mod timer {
+    use super::{SahneError, arch, syscall, map_kernel_error, Handle, resource};
+    use core::time::Duration;
+
+    // Zamanlayıcı kurma bayrakları (sahne.h SAHNE_TIMER_*)
+    pub const RELATIVE: u32 = 0;
+    pub const ABSOLUTE: u32 = 1 << 0;
+
+    /// Yeni bir zamanlayıcı Handle'ı oluşturur (başlangıçta kurulmamıştır).
+    /// Zamanlayıcı dolduğunda handle `poll::PollEventFlags::READABLE` olur.
+    pub fn create() -> Result<Handle, SahneError> {
+        let result = unsafe {
+            syscall(arch::SYSCALL_TIMER_CREATE, 0, 0, 0, 0, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(Handle(result as u64))
+        }
+    }
+
+    /// Zamanlayıcıyı kurar. `initial_ns` 0 ise zamanlayıcı durdurulur; `interval_ns` 0 ise tek seferliktir.
+    /// `flags`: RELATIVE (şimdiden itibaren) veya ABSOLUTE (kernel::get_time saatine göre).
+    pub fn set(handle: Handle, initial_ns: u64, interval_ns: u64, flags: u32) -> Result<(), SahneError> {
+        if !handle.is_valid() {
+            return Err(SahneError::InvalidHandle);
+        }
+        let result = unsafe {
+            syscall(arch::SYSCALL_TIMER_SET, handle.raw(), initial_ns, interval_ns, flags as u64, 0)
+        };
+        if result < 0 {
+            Err(map_kernel_error(result))
+        } else {
+            Ok(())
+        }
+    }
+
+    /// Tek seferlik göreli zamanlayıcı kurar.
+    pub fn set_oneshot(handle: Handle, after: Duration) -> Result<(), SahneError> {
+        set(handle, u64::try_from(after.as_nanos()).unwrap_or(u64::MAX).max(1), 0, RELATIVE)
+    }
+
+    /// Periyodik zamanlayıcı kurar.
+    pub fn set_periodic(handle: Handle, period: Duration) -> Result<(), SahneError> {
+        let ns = u64::try_from(period.as_nanos()).unwrap_or(u64::MAX).max(1);
+        set(handle, ns, ns, RELATIVE)
+    }
+
+    /// Zamanlayıcıyı durdurur.
+    pub fn disarm(handle: Handle) -> Result<(), SahneError> {
+        set(handle, 0, 0, RELATIVE)
+    }
+
+    /// Son okumadan beri dolma sayısını okur ve sıfırlar (non-blocking handle'da dolmamışsa WouldBlock).
+    pub fn read_expirations(handle: Handle) -> Result<u64, SahneError> {
+        let mut buf = [0u8; 8];
+        let n = resource::read(handle, &mut buf)?;
+        if n != buf.len() {
+            return Err(SahneError::InvalidOperation);
+        }
+        Ok(u64::from_le_bytes(buf))
+    }
+
+    // --- Hiyerarşik zamanlayıcı çarkı ---
+    // 4 seviye x 64 yuva: seviye L'deki bir yuva 64^L tik genişliğindedir (toplam 2^24 tik aralık).
+    // Daha uzak zamanlayıcılar en üst seviyeye kırpılarak konur ve kaskad sırasında tekrar yerleştirilir.
+    // Ekleme/iptal O(1), tik başına maliyet yalnızca dolu yuvalar kadardır; boş aralıklar atlanır.
+    const LEVELS: usize = 4;
+    const SLOT_BITS: u32 = 6;
+    const SLOTS: usize = 1 << SLOT_BITS;
+    const SLOT_MASK: u64 = (SLOTS as u64) - 1;
+    const NIL: u32 = u32::MAX;
+    const MAX_DELTA: u64 = 1 << (SLOT_BITS * LEVELS as u32);
+
+    /// Çarktaki tek bir mantıksal zamanlayıcının deposu. Çağıran `[TimerNode::EMPTY; N]` ayırır.
+    #[derive(Debug, Copy, Clone)]
+    pub struct TimerNode {
+        expires: u64,    // Dolma zamanı (tik)
+        token: u64,      // Kullanıcı verisi (örn. oturum ID'si)
+        next: u32,
+        prev: u32,
+        slot: u32,       // level * SLOTS + yuva, NIL = boşta
+        generation: u32, // Eski TimerId'lerin yanlışlıkla iptalini önler
+    }
+
+    impl TimerNode {
+        pub const EMPTY: TimerNode = TimerNode { expires: 0, token: 0, next: NIL, prev: NIL, slot: NIL, generation: 0 };
+    }
+
+    /// Çarka eklenmiş bir zamanlayıcıyı tanımlar (iptal için).
+    #[derive(Debug, Copy, Clone, PartialEq, Eq)]
+    pub struct TimerId {
+        index: u32,
+        generation: u32,
+    }
+
+    /// Çağıranın verdiği depo üzerinde çalışan, heap kullanmayan hiyerarşik zamanlayıcı çarkı.
+    pub struct TimerWheel<'a> {
+        nodes: &'a mut [TimerNode],
+        heads: [[u32; SLOTS]; LEVELS],
+        occupied: [u64; LEVELS], // Seviye başına dolu yuva bit haritası
+        free_head: u32,
+        tick_ns: u64,
+        origin_ns: u64, // Tik 0'ın mutlak zamanı
+        now: u64,       // İşlenmiş son tik
+        len: usize,
+    }
+
+    impl<'a> TimerWheel<'a> {
+        /// `tick_ns` çözünürlüğünde, `now_ns` anından başlayan bir çark oluşturur.
+        pub fn new(nodes: &'a mut [TimerNode], tick_ns: u64, now_ns: u64) -> Self {
+            let n = nodes.len();
+            for (i, node) in nodes.iter_mut().enumerate() {
+                *node = TimerNode::EMPTY;
+                node.next = if i + 1 < n { (i + 1) as u32 } else { NIL };
+            }
+            TimerWheel {
+                nodes,
+                heads: [[NIL; SLOTS]; LEVELS],
+                occupied: [0; LEVELS],
+                free_head: if n > 0 { 0 } else { NIL },
+                tick_ns: tick_ns.max(1),
+                origin_ns: now_ns,
+                now: 0,
+                len: 0,
+            }
+        }
+
+        pub fn len(&self) -> usize {
+            self.len
+        }
+
+        pub fn is_empty(&self) -> bool {
+            self.len == 0
+        }
+
+        /// `delay` sonra dolacak bir zamanlayıcı ekler. Depo doluysa OutOfMemory döner.
+        pub fn insert(&mut self, delay: Duration, token: u64) -> Result<TimerId, SahneError> {
+            let index = self.free_head;
+            if index == NIL {
+                return Err(SahneError::OutOfMemory);
+            }
+            self.free_head = self.nodes[index as usize].next;
+            // Taşmayan yukarı yuvarlamalı bölme; çok uzun süreler u64::MAX'ta doyar
+            let nanos = u64::try_from(delay.as_nanos()).unwrap_or(u64::MAX);
+            let ticks = nanos / self.tick_ns + (nanos % self.tick_ns != 0) as u64;
+            let node = &mut self.nodes[index as usize];
+            node.expires = self.now.saturating_add(ticks.max(1));
+            node.token = token;
+            let generation = node.generation;
+            self.link(index);
+            self.len += 1;
+            Ok(TimerId { index, generation })
+        }
+
+        /// Zamanlayıcıyı iptal eder. Zaten dolmuş veya iptal edilmişse false döner.
+        pub fn cancel(&mut self, id: TimerId) -> bool {
+            let node = match self.nodes.get(id.index as usize) {
+                Some(n) => *n,
+                None => return false,
+            };
+            if node.generation != id.generation || node.slot == NIL {
+                return false;
+            }
+            self.unlink(id.index);
+            self.release(id.index);
+            true
+        }
+
+        /// Çarkı `now_ns` anına ilerletir ve dolan her zamanlayıcı için `on_fire(token)` çağırır.
+        /// Dolan zamanlayıcı sayısını döner.
+        pub fn advance<F: FnMut(u64)>(&mut self, now_ns: u64, mut on_fire: F) -> usize {
+            let target = now_ns.saturating_sub(self.origin_ns) / self.tick_ns;
+            let mut fired = 0;
+            while self.now < target {
+                if self.len == 0 {
+                    self.now = target;
+                    break;
+                }
+                if self.occupied[0] == 0 {
+                    // Seviye 0 boş: bir sonraki kaskad sınırına kadar atla
+                    let before_boundary = self.now | SLOT_MASK;
+                    if before_boundary >= target {
+                        self.now = target;
+                        break;
+                    }
+                    self.now = before_boundary;
+                }
+                self.now += 1;
+                self.cascade();
+                let slot = (self.now & SLOT_MASK) as usize;
+                loop {
+                    let index = self.heads[0][slot];
+                    if index == NIL {
+                        break;
+                    }
+                    let token = self.nodes[index as usize].token;
+                    self.unlink(index);
+                    self.release(index);
+                    on_fire(token);
+                    fired += 1;
+                }
+            }
+            fired
+        }
+
+        /// Bir sonraki dolma anı için çekirdek zamanlayıcısının kurulacağı mutlak zaman (ns).
+        /// Üst seviyelerdeki yuvalar için kaskad anı döner (erken uyanma, kaskad sonrası yeniden kurulur).
+        pub fn next_deadline_ns(&self) -> Option<u64> {
+            let mut earliest: Option<u64> = None;
+            for level in 0..LEVELS {
+                let bits = self.occupied[level];
+                if bits == 0 {
+                    continue;
+                }
+                let shift = SLOT_BITS * level as u32;
+                let current = ((self.now >> shift) & SLOT_MASK) as u32;
+                // Mevcut konumdan sonraki ilk dolu yuva (dairesel)
+                let rotated = bits.rotate_right((current + 1) % SLOTS as u32);
+                let distance = rotated.trailing_zeros() as u64 + 1;
+                let tick = ((self.now >> shift) + distance) << shift;
+                earliest = Some(earliest.map_or(tick, |e| e.min(tick)));
+            }
+            earliest.map(|tick| self.origin_ns + tick * self.tick_ns)
+        }
+
+        /// Çekirdek zamanlayıcısını bir sonraki dolma anına kurar (çark boşsa durdurur).
+        /// `timer_handle` poll kümesine READABLE ile eklenir; dolunca `read_expirations` + `advance` + `arm` çağrılır.
+        pub fn arm(&self, timer_handle: Handle) -> Result<(), SahneError> {
+            match self.next_deadline_ns() {
+                Some(at) => set(timer_handle, at.max(1), 0, ABSOLUTE),
+                None => disarm(timer_handle),
+            }
+        }
+
+        fn cascade(&mut self) {
+            for level in 1..LEVELS {
+                let shift = SLOT_BITS * level as u32;
+                if self.now & ((1u64 << shift) - 1) != 0 {
+                    break; // Bu seviyenin sınırında değiliz, üst seviyeler de değil
+                }
+                let slot = ((self.now >> shift) & SLOT_MASK) as usize;
+                let mut index = self.heads[level][slot];
+                self.heads[level][slot] = NIL;
+                self.occupied[level] &= !(1u64 << slot);
+                while index != NIL {
+                    let next = self.nodes[index as usize].next;
+                    self.link(index); // Şimdiki zamana göre daha alt seviyeye yerleşir
+                    index = next;
+                }
+            }
+        }
+
+        fn link(&mut self, index: u32) {
+            let expires = self.nodes[index as usize].expires;
+            // Dolmuş düğüm (kaskad sınırında) delta 0 ile şimdi boşaltılacak yuvaya düşer
+            let delta = expires.saturating_sub(self.now);
+            let (level, slot) = if delta >= MAX_DELTA {
+                // Aralık dışı: en üst seviyenin en uzak yuvasına koy, kaskadda yeniden değerlendirilir
+                let top = LEVELS - 1;
+                let shift = SLOT_BITS * top as u32;
+                (top, (((self.now + MAX_DELTA - 1) >> shift) & SLOT_MASK) as usize)
+            } else {
+                let mut level = 0;
+                while level + 1 < LEVELS && delta >= (1u64 << (SLOT_BITS * (level as u32 + 1))) {
+                    level += 1;
+                }
+                let shift = SLOT_BITS * level as u32;
+                (level, ((self.now + delta) >> shift & SLOT_MASK) as usize)
+            };
+            let head = self.heads[level][slot];
+            {
+                let node = &mut self.nodes[index as usize];
+                node.slot = (level * SLOTS + slot) as u32;
+                node.prev = NIL;
+                node.next = head;
+            }
+            if head != NIL {
+                self.nodes[head as usize].prev = index;
+            }
+            self.heads[level][slot] = index;
+            self.occupied[level] |= 1u64 << slot;
+        }
+
+        fn unlink(&mut self, index: u32) {
+            let node = self.nodes[index as usize];
+            let level = node.slot as usize / SLOTS;
+            let slot = node.slot as usize % SLOTS;
+            if node.prev != NIL {
+                self.nodes[node.prev as usize].next = node.next;
+            } else {
+                self.heads[level][slot] = node.next;
+            }
+            if node.next != NIL {
+                self.nodes[node.next as usize].prev = node.prev;
+            }
+            if self.heads[level][slot] == NIL {
+                self.occupied[level] &= !(1u64 << slot);
+            }
+            self.nodes[index as usize].slot = NIL;
+        }
+
+        fn release(&mut self, index: u32) {
+            let node = &mut self.nodes[index as usize];
+            node.slot = NIL;
+            node.generation = node.generation.wrapping_add(1);
+            node.prev = NIL;
+            node.next = self.free_head;
+            self.free_head = index;
+            self.len -= 1;
+        }
+    }
+}
+
+// Yeni bir modül: Kanallar üzerinde istek/yanıt (RPC) çerçevelemesi ve boru hattı istemcisi
+// Çerçeve formatı sahne.h SahneRpcHeader_t ile aynıdır; her RPC mesajı tek bir kanal mesajıdır.
+// Heap kullanılmaz: bekleyen istekler sabit kapasiteli bir tabloda (N) tutulur.
+// İş parçacığı havuzlu sunucu dağıtıcısı C++ tarafındadır (sahne_rpc.hpp); bu modül aynı kablo formatını konuşur.
+pub mod rpc {
+    use super::{SahneError, Handle, kernel, messaging, poll};
+    use core::time::Duration;
+
+    pub const VERSION: u16 = 1;
+    pub const KIND_REQUEST: u16 = 1;
+    pub const KIND_RESPONSE: u16 = 2;
+    pub const KIND_CANCEL: u16 = 3;
+    pub const NO_DEADLINE: u64 = 0;
+
+    /// RPC mesaj başlığı (sahne.h SahneRpcHeader_t).
+    #[derive(Debug, Copy, Clone, PartialEq, Eq, Default)]
+    #[repr(C)]
+    pub struct RpcHeader {
+        pub version: u16,
+        pub kind: u16,
+        pub method: u32,
+        pub request_id: u64,  // Kanal başına benzersiz korelasyon ID'si
+        pub deadline_ns: u64, // Mutlak son tarih (kernel::get_time saatine göre), 0 = yok
+        pub status: i32,      // Yanıtta sahne.h SAHNE_SUCCESS / SAHNE_ERROR_* kodu
+        pub payload_len: u32,
+    }
+
+    pub const HEADER_SIZE: usize = core::mem::size_of::<RpcHeader>();
+
+    /// Başlığı ve veriyi `out`'a yazar; mesajın toplam uzunluğunu döner.
+    pub fn encode(header: &RpcHeader, payload: &[u8], out: &mut [u8]) -> Result<usize, SahneError> {
+        let total = HEADER_SIZE + payload.len();
+        if out.len() < total || payload.len() != header.payload_len as usize {
+            return Err(SahneError::InvalidParameter);
+        }
+        let header_bytes = unsafe {
+            core::slice::from_raw_parts(header as *const RpcHeader as *const u8, HEADER_SIZE)
+        };
+        out[..HEADER_SIZE].copy_from_slice(header_bytes);
+        out[HEADER_SIZE..total].copy_from_slice(payload);
+        Ok(total)
+    }
+
+    /// Bir kanal mesajını başlık ve veriye ayırır.
+    pub fn decode(message: &[u8]) -> Result<(RpcHeader, &[u8]), SahneError> {
+        if message.len() < HEADER_SIZE {
+            return Err(SahneError::CommunicationError);
+        }
+        let header = unsafe { core::ptr::read_unaligned(message.as_ptr() as *const RpcHeader) };
+        if header.version != VERSION || header.payload_len as usize != message.len() - HEADER_SIZE {
+            return Err(SahneError::CommunicationError);
+        }
+        Ok((header, &message[HEADER_SIZE..]))
+    }
+
+    /// Göreli zaman aşımını mutlak son tarihe çevirir (None = son tarih yok).
+    /// Çok uzun süreler NO_DEADLINE'a sarmak yerine u64::MAX'ta doyar.
+    pub fn deadline_after(timeout: Option<Duration>) -> Result<u64, SahneError> {
+        match timeout {
+            None => Ok(NO_DEADLINE),
+            Some(d) => Ok(kernel::get_time()?.saturating_add(u64::try_from(d.as_nanos()).unwrap_or(u64::MAX))),
+        }
+    }
+
+    #[derive(Debug, Copy, Clone)]
+    struct Pending {
+        request_id: u64,
+        deadline_ns: u64,
+    }
+
+    /// Tek bir kanal üzerinde en fazla N bekleyen isteği taşıyan boru hattı istemcisi.
+    pub struct Client<const N: usize> {
+        channel: Handle,
+        next_id: u64,
+        pending: [Option<Pending>; N],
+        in_flight: usize,
+    }
+
+    impl<const N: usize> Client<N> {
+        pub const fn new(channel: Handle) -> Self {
+            Client { channel, next_id: 1, pending: [None; N], in_flight: 0 }
+        }
+
+        pub fn in_flight(&self) -> usize {
+            self.in_flight
+        }
+
+        /// Bir istek gönderir ve yanıtı beklemeden request_id döner.
+        /// `scratch` en az HEADER_SIZE + payload.len() byte olmalıdır.
+        /// Tablo doluysa ResourceBusy döner; önce `poll_responses` ile yanıtlar toplanmalıdır.
+        pub fn start(&mut self, method: u32, payload: &[u8], deadline_ns: u64, scratch: &mut [u8]) -> Result<u64, SahneError> {
+            let slot = self.pending.iter().position(|p| p.is_none()).ok_or(SahneError::ResourceBusy)?;
+            let header = RpcHeader {
+                version: VERSION,
+                kind: KIND_REQUEST,
+                method,
+                request_id: self.next_id,
+                deadline_ns,
+                status: 0,
+                payload_len: payload.len() as u32,
+            };
+            let len = encode(&header, payload, scratch)?;
+            messaging::send_on_channel(self.channel, &scratch[..len])?;
+            self.pending[slot] = Some(Pending { request_id: header.request_id, deadline_ns });
+            self.in_flight += 1;
+            self.next_id += 1;
+            Ok(header.request_id)
+        }
+
+        /// En fazla `timeout` kadar yanıt bekler; gelen her yanıt ve son tarihi geçen her istek için
+        /// `on_complete(request_id, sonuç)` çağrılır. Tamamlanan istek sayısını döner.
+        pub fn poll_responses<F>(&mut self, buffer: &mut [u8], spans: &mut [messaging::MessageSpan],
+                                 timeout: Option<Duration>, mut on_complete: F) -> Result<usize, SahneError>
+        where
+            F: FnMut(u64, Result<&[u8], SahneError>),
+        {
+            let mut completed = 0;
+            if self.in_flight > 0 {
+                let mut entries = [poll::PollEntry {
+                    handle: self.channel,
+                    events_in: poll::PollEventFlags::READABLE | poll::PollEventFlags::DISCONNECTED,
+                    events_out: poll::PollEventFlags::NONE,
+                }];
+                poll::poll(&mut entries, self.clamp_timeout(timeout)?)?;
+                if entries[0].events_out & poll::PollEventFlags::READABLE != poll::PollEventFlags::NONE {
+                    let count = match messaging::receive_many(self.channel, buffer, spans) {
+                        Ok(n) => n,
+                        Err(SahneError::NoMessage) | Err(SahneError::WouldBlock) => 0,
+                        Err(e) => return Err(e),
+                    };
+                    for span in &spans[..count] {
+                        let (header, payload) = match decode(span.data(buffer)) {
+                            Ok(v) => v,
+                            Err(_) => continue, // Bozuk mesaj
+                        };
+                        if header.kind != KIND_RESPONSE || !self.take(header.request_id) {
+                            continue; // Zaman aşımına uğramış isteğin geç yanıtı
+                        }
+                        let result = if header.status == 0 { Ok(payload) } else { Err(status_to_error(header.status)) };
+                        on_complete(header.request_id, result);
+                        completed += 1;
+                    }
+                } else if entries[0].events_out & poll::PollEventFlags::DISCONNECTED != poll::PollEventFlags::NONE {
+                    for slot in self.pending.iter_mut() {
+                        if let Some(p) = slot.take() {
+                            on_complete(p.request_id, Err(SahneError::Disconnected));
+                            completed += 1;
+                        }
+                    }
+                    self.in_flight = 0;
+                }
+            }
+            let now = kernel::get_time()?;
+            for slot in self.pending.iter_mut() {
+                if let Some(p) = *slot {
+                    if p.deadline_ns != NO_DEADLINE && p.deadline_ns <= now {
+                        *slot = None;
+                        self.in_flight -= 1;
+                        on_complete(p.request_id, Err(SahneError::TimedOut));
+                        completed += 1;
+                    }
+                }
+            }
+            Ok(completed)
+        }
+
+        fn take(&mut self, request_id: u64) -> bool {
+            for slot in self.pending.iter_mut() {
+                if matches!(slot, Some(p) if p.request_id == request_id) {
+                    *slot = None;
+                    self.in_flight -= 1;
+                    return true;
+                }
+            }
+            false
+        }
+
+        // Poll bekleme süresini en yakın son tarihe göre kısaltır.
+        fn clamp_timeout(&self, timeout: Option<Duration>) -> Result<Option<Duration>, SahneError> {
+            let earliest = self.pending.iter().flatten()
+                .filter(|p| p.deadline_ns != NO_DEADLINE)
+                .map(|p| p.deadline_ns)
+                .min();
+            let earliest = match earliest {
+                Some(d) => d,
+                None => return Ok(timeout),
+            };
+            let now = kernel::get_time()?;
+            let until = Duration::from_nanos(earliest.saturating_sub(now));
+            Ok(Some(match timeout {
+                Some(t) if t < until => t,
+                _ => until,
+            }))
+        }
+    }
+
+    // Yanıttaki sahne.h SAHNE_ERROR_* kodunu SahneError'a çevirir (map_sahne_error_to_c'nin tersi).
+    fn status_to_error(status: i32) -> SahneError {
+        match status {
+            1 => SahneError::OutOfMemory,
+            2 => SahneError::InvalidAddress,
+            3 => SahneError::InvalidParameter,
+            4 => SahneError::ResourceNotFound,
+            5 => SahneError::PermissionDenied,
+            6 => SahneError::ResourceBusy,
+            7 => SahneError::Interrupted,
+            8 => SahneError::NoMessage,
+            9 => SahneError::InvalidOperation,
+            10 => SahneError::NotSupported,
+            12 => SahneError::TaskCreationFailed,
+            13 => SahneError::InvalidHandle,
+            14 => SahneError::HandleLimitExceeded,
+            15 => SahneError::NamingError,
+            17 => SahneError::WouldBlock,
+            18 => SahneError::Disconnected,
+            19 => SahneError::TimedOut,
+            20 => SahneError::ChecksumMismatch,
+            21 => SahneError::Lagged,
+            _ => SahneError::CommunicationError,
+        }
+    }
+}
+
+// Yeni bir modül: sahne:// isim alanları için paralel ağaç gezgini
+// resource::enumerate üzerine kuruludur: girdiler durum bilgileriyle birlikte tampon dolusu gelir,
+// girdi başına acquire/stat/release gerekmez. Heap kullanılmaz: bekleyen dizin yolları çağıranın verdiği
+// sabit kapasiteli bir kuyrukta (PathSlot) tutulur. Ek işçiler task::create_thread ile başlatılır,
+// çağıran iş parçacığı da işçi olarak çalışır ve tüm işçiler bitene kadar döner.
+pub mod walk {
+    use super::{SahneError, Handle, resource, task};
+    use core::cell::UnsafeCell;
+    use core::ffi::c_void;
+    use core::sync::atomic::{AtomicBool, AtomicU64, AtomicUsize, Ordering};
+
+    /// Bir dizin yolunun en fazla uzunluğu (byte).
+    pub const MAX_PATH: usize = 512;
+    /// İşçi başına enumerate tamponu (işçinin yığınında tutulur; stack_size buna göre seçilmeli).
+    pub const ENUM_BUFFER_SIZE: usize = 16 * 1024;
+
+    /// Kuyruktaki bir dizin yolu.
+    #[derive(Copy, Clone)]
+    pub struct PathSlot {
+        len: u16,
+        bytes: [u8; MAX_PATH],
+    }
+
+    impl PathSlot {
+        pub const EMPTY: PathSlot = PathSlot { len: 0, bytes: [0; MAX_PATH] };
+
+        pub fn as_bytes(&self) -> &[u8] {
+            &self.bytes[..self.len as usize]
+        }
+
+        fn set(&mut self, path: &[u8]) -> bool {
+            if path.len() > MAX_PATH {
+                return false;
+            }
+            self.bytes[..path.len()].copy_from_slice(path);
+            self.len = path.len() as u16;
+            true
+        }
+
+        // dir + '/' + name (dir zaten '/' ile bitiyorsa ayırıcı eklenmez, örn. "sahne://")
+        fn join(&mut self, dir: &[u8], name: &[u8]) -> bool {
+            let sep = if dir.last() == Some(&b'/') { 0 } else { 1 };
+            let len = dir.len() + sep + name.len();
+            if len > MAX_PATH {
+                return false;
+            }
+            self.bytes[..dir.len()].copy_from_slice(dir);
+            if sep != 0 {
+                self.bytes[dir.len()] = b'/';
+            }
+            self.bytes[dir.len() + sep..len].copy_from_slice(name);
+            self.len = len as u16;
+            true
+        }
+    }
+
+    // Spin kilidi ile korunan halka kuyruk ve ilk hata
+    struct Queue {
+        slots: *mut PathSlot,
+        capacity: usize,
+        head: usize,
+        len: usize,
+        error: Option<SahneError>,
+    }
+
+    impl Queue {
+        fn push(&mut self, path: &PathSlot) -> bool {
+            if self.len == self.capacity {
+                return false;
+            }
+            let tail = (self.head + self.len) % self.capacity;
+            unsafe { *self.slots.add(tail) = *path; }
+            self.len += 1;
+            true
+        }
+
+        fn pop(&mut self, out: &mut PathSlot) -> bool {
+            if self.len == 0 {
+                return false;
+            }
+            *out = unsafe { *self.slots.add(self.head) };
+            self.head = (self.head + 1) % self.capacity;
+            self.len -= 1;
+            true
+        }
+    }
+
+    struct Shared<F> {
+        lock: AtomicBool,
+        queue: UnsafeCell<Queue>,
+        pending: AtomicUsize, // Kuyruktaki + işlenmekte olan dizin sayısı; 0 olunca gezinme biter
+        running: AtomicUsize, // Henüz çıkmamış ek işçi iş parçacığı sayısı
+        stop: AtomicBool,
+        entries: AtomicU64,
+        visitor: *const F,
+    }
+
+    unsafe impl<F: Sync> Sync for Shared<F> {}
+
+    impl<F> Shared<F> {
+        fn with_queue<R>(&self, f: impl FnOnce(&mut Queue) -> R) -> R {
+            while self.lock.compare_exchange_weak(false, true, Ordering::Acquire, Ordering::Relaxed).is_err() {
+                let _ = task::yield_now();
+            }
+            let result = f(unsafe { &mut *self.queue.get() });
+            self.lock.store(false, Ordering::Release);
+            result
+        }
+
+        fn fail(&self, error: SahneError) {
+            self.with_queue(|q| {
+                if q.error.is_none() {
+                    q.error = Some(error);
+                }
+            });
+            self.stop.store(true, Ordering::Release);
+        }
+    }
+
+    /// `root` altındaki tüm girdileri `threads` işçiyle (çağıran dahil) gezer ve her girdi için
+    /// `visitor(dizin_yolu, girdi)` çağırır. Ziyaretçi birden çok iş parçacığından eşzamanlı çağrılır.
+    /// `queue`: bekleyen dizinler için depolama; aynı anda bekleyen dizin sayısını karşılamalıdır,
+    /// aksi halde gezinme OutOfMemory ile durur. `stack_size` ek işçilerin yığın boyutudur
+    /// (ENUM_BUFFER_SIZE'dan büyük olmalı). İlk hatada gezinme durur ve hata döner;
+    /// başarıda ziyaret edilen girdi sayısı döner.
+    pub fn walk_parallel<F>(root: &str, queue: &mut [PathSlot], threads: usize, stack_size: usize, visitor: &F) -> Result<u64, SahneError>
+    where
+        F: Fn(&[u8], &resource::DirEntry) + Sync,
+    {
+        let mut root_slot = PathSlot::EMPTY;
+        if queue.is_empty() || !root_slot.set(root.as_bytes()) {
+            return Err(SahneError::InvalidParameter);
+        }
+        let shared = Shared {
+            lock: AtomicBool::new(false),
+            queue: UnsafeCell::new(Queue { slots: queue.as_mut_ptr(), capacity: queue.len(), head: 0, len: 0, error: None }),
+            pending: AtomicUsize::new(1),
+            running: AtomicUsize::new(0),
+            stop: AtomicBool::new(false),
+            entries: AtomicU64::new(0),
+            visitor: visitor as *const F,
+        };
+        shared.with_queue(|q| q.push(&root_slot));
+
+        let arg = &shared as *const Shared<F> as *mut c_void;
+        for _ in 1..threads.max(1) {
+            shared.running.fetch_add(1, Ordering::AcqRel);
+            if task::create_thread(thread_entry::<F>, stack_size, arg).is_err() {
+                shared.running.fetch_sub(1, Ordering::AcqRel);
+                break; // Daha az işçiyle devam et
+            }
+        }
+        run(&shared);
+        // `shared` bu yığın çerçevesinde yaşadığından tüm işçilerin çıkmasını bekle
+        while shared.running.load(Ordering::Acquire) != 0 {
+            let _ = task::yield_now();
+        }
+
+        match shared.with_queue(|q| q.error) {
+            Some(e) => Err(e),
+            None => Ok(shared.entries.load(Ordering::Relaxed)),
+        }
+    }
+
+    fn thread_entry<F>(arg: *mut c_void)
+    where
+        F: Fn(&[u8], &resource::DirEntry) + Sync,
+    {
+        let shared = unsafe { &*(arg as *const Shared<F>) };
+        run(shared);
+        shared.running.fetch_sub(1, Ordering::AcqRel); // Bundan sonra `shared`'a dokunulmaz
+        task::exit_thread(0);
+    }
+
+    fn run<F>(shared: &Shared<F>)
+    where
+        F: Fn(&[u8], &resource::DirEntry) + Sync,
+    {
+        let mut buffer = [0u8; ENUM_BUFFER_SIZE];
+        let mut dir = PathSlot::EMPTY;
+        loop {
+            if shared.stop.load(Ordering::Acquire) {
+                return;
+            }
+            if shared.with_queue(|q| q.pop(&mut dir)) {
+                if let Err(e) = walk_dir(shared, &dir, &mut buffer) {
+                    shared.fail(e);
+                }
+                shared.pending.fetch_sub(1, Ordering::AcqRel);
+            } else if shared.pending.load(Ordering::Acquire) == 0 {
+                return;
+            } else {
+                let _ = task::yield_now(); // Diğer işçiler yeni dizin üretebilir
+            }
+        }
+    }
+
+    fn walk_dir<F>(shared: &Shared<F>, dir: &PathSlot, buffer: &mut [u8]) -> Result<(), SahneError>
+    where
+        F: Fn(&[u8], &resource::DirEntry) + Sync,
+    {
+        let path = dir.as_bytes();
+        let id = core::str::from_utf8(path).map_err(|_| SahneError::NamingError)?;
+        let handle = resource::acquire(id, resource::MODE_READ)?;
+        let result = walk_handle(shared, path, handle, buffer);
+        let _ = resource::release(handle);
+        result
+    }
+
+    fn walk_handle<F>(shared: &Shared<F>, path: &[u8], handle: Handle, buffer: &mut [u8]) -> Result<(), SahneError>
+    where
+        F: Fn(&[u8], &resource::DirEntry) + Sync,
+    {
+        let visitor = unsafe { &*shared.visitor };
+        let mut cookie = resource::ENUM_COOKIE_START;
+        loop {
+            if shared.stop.load(Ordering::Relaxed) {
+                return Ok(());
+            }
+            let count = resource::enumerate(handle, buffer, &mut cookie)?;
+            if count == 0 {
+                return Ok(());
+            }
+            let mut entries = resource::DirEntries::new(buffer, count);
+            for entry in &mut entries {
+                visitor(path, &entry);
+                if entry.is_directory() {
+                    let mut child = PathSlot::EMPTY;
+                    if !child.join(path, entry.name) {
+                        return Err(SahneError::InvalidParameter); // Yol MAX_PATH'i aşıyor
+                    }
+                    shared.pending.fetch_add(1, Ordering::AcqRel);
+                    if !shared.with_queue(|q| q.push(&child)) {
+                        shared.pending.fetch_sub(1, Ordering::AcqRel);
+                        return Err(SahneError::OutOfMemory); // Kuyruk kapasitesi yetersiz
+                    }
+                }
+            }
+            if let Some(err) = entries.error() {
+                return Err(err);
+            }
+            shared.entries.fetch_add(count as u64, Ordering::Relaxed);
+        }
+    }
+}
+
+// Yeni bir modül: CRC32C ve xxHash64 sağlama toplamları ve blok bazlı doğrulama aşaması
+// CRC32C çalışma zamanında seçilen bir çekirdekle hesaplanır: x86_64'te SSE4.2 `crc32` komutu,
+// aarch64'te ARMv8 CRC uzantısı, diğerlerinde slice-by-8 tablo. Donanım çekirdekleri komut gecikmesini
+// gizlemek için büyük tamponları üç bağımsız akışa bölüp sonuçları GF(2) çarpımıyla birleştirir.
+// xxHash64 dört bağımsız 64-bit şeritle çalışır ve her mimaride skaler koddur.
+// Blok aşaması (BlockWriter / read_verified_block) sahne.h ChecksumSidecarHeader_t formatını kullanır.
+pub mod checksum {
+    use super::{SahneError, Handle, resource};
+    #[cfg(target_arch = "aarch64")]
+    use super::kernel;
+    use core::sync::atomic::{AtomicU8, AtomicU32, Ordering};
+
+    // Algoritmalar (sahne.h SAHNE_CHECKSUM_*)
+    pub const CRC32C: u16 = 1;
+    pub const XXHASH64: u16 = 2;
+
+    // CRC32C çekirdekleri (sahne.h SAHNE_CHECKSUM_KERNEL_*)
+    pub const KERNEL_SCALAR: u32 = 0;
+    pub const KERNEL_SSE42: u32 = 1;
+    pub const KERNEL_ARM_CRC: u32 = 2;
+
+    // Yan dosya (sidecar) biçimi
+    pub const SIDECAR_MAGIC: u32 = 0x314B_4353; // "SCK1"
+    pub const SIDECAR_VERSION: u16 = 1;
+
+    /// Yan dosya başlığı (sahne.h ChecksumSidecarHeader_t ile aynı düzen). Ardından blok başına
+    /// bir u64 sağlama toplamı gelir (CRC32C sıfırla genişletilir).
+    #[repr(C)]
+    #[derive(Debug, Copy, Clone, PartialEq, Eq)]
+    pub struct SidecarHeader {
+        pub magic: u32,
+        pub version: u16,
+        pub algorithm: u16,
+        pub block_size: u32,
+        pub reserved: u32,
+    }
+
+    const SIDECAR_HEADER_SIZE: u64 = core::mem::size_of::<SidecarHeader>() as u64;
+
+    // --- CRC32C (Castagnoli, yansıtılmış polinom) ---
+    const POLY: u32 = 0x82F6_3B78;
+
+    const fn make_tables() -> [[u32; 256]; 8] {
+        let mut tables = [[0u32; 256]; 8];
+        let mut n = 0;
+        while n < 256 {
+            let mut crc = n as u32;
+            let mut k = 0;
+            while k < 8 {
+                crc = if crc & 1 != 0 { (crc >> 1) ^ POLY } else { crc >> 1 };
+                k += 1;
+            }
+            tables[0][n] = crc;
+            n += 1;
+        }
+        let mut t = 1;
+        while t < 8 {
+            let mut n = 0;
+            while n < 256 {
+                let prev = tables[t - 1][n];
+                tables[t][n] = (prev >> 8) ^ tables[0][(prev & 0xFF) as usize];
+                n += 1;
+            }
+            t += 1;
+        }
+        tables
+    }
+
+    static TABLES: [[u32; 256]; 8] = make_tables();
+
+    // a(x) * b(x) mod P(x) (yansıtılmış gösterim)
+    const fn multmodp(a: u32, mut b: u32) -> u32 {
+        let mut m: u32 = 1 << 31;
+        let mut p: u32 = 0;
+        loop {
+            if a & m != 0 {
+                p ^= b;
+                if a & (m - 1) == 0 {
+                    break;
+                }
+            }
+            m >>= 1;
+            b = if b & 1 != 0 { (b >> 1) ^ POLY } else { b >> 1 };
+        }
+        p
+    }
+
+    // x^(8 * n) mod P(x): bir CRC kaydını n sıfır byte ilerletmek için çarpan
+    const fn x8nmodp(mut n: u64) -> u32 {
+        let mut x2k: u32 = 1 << 30; // x^1, sonra x^(2^k)
+        let mut k = 0;
+        while k < 3 {
+            x2k = multmodp(x2k, x2k); // x^8'e kadar kare al
+            k += 1;
+        }
+        let mut p: u32 = 1 << 31; // x^0
+        while n != 0 {
+            if n & 1 != 0 {
+                p = multmodp(x2k, p);
+            }
+            x2k = multmodp(x2k, x2k);
+            n >>= 1;
+        }
+        p
+    }
+
+    // Donanım çekirdeklerinde üç akışlı işlem için akış uzunluğu ve birleştirme çarpanı
+    const LANE: usize = 4096;
+    const LANE_SHIFT: u32 = x8nmodp(LANE as u64);
+
+    fn crc32c_scalar_raw(mut crc: u32, data: &[u8]) -> u32 {
+        let mut chunks = data.chunks_exact(8);
+        for chunk in &mut chunks {
+            let lo = u32::from_le_bytes([chunk[0], chunk[1], chunk[2], chunk[3]]) ^ crc;
+            let hi = u32::from_le_bytes([chunk[4], chunk[5], chunk[6], chunk[7]]);
+            crc = TABLES[7][(lo & 0xFF) as usize]
+                ^ TABLES[6][((lo >> 8) & 0xFF) as usize]
+                ^ TABLES[5][((lo >> 16) & 0xFF) as usize]
+                ^ TABLES[4][(lo >> 24) as usize]
+                ^ TABLES[3][(hi & 0xFF) as usize]
+                ^ TABLES[2][((hi >> 8) & 0xFF) as usize]
+                ^ TABLES[1][((hi >> 16) & 0xFF) as usize]
+                ^ TABLES[0][(hi >> 24) as usize];
+        }
+        for &b in chunks.remainder() {
+            crc = (crc >> 8) ^ TABLES[0][((crc ^ b as u32) & 0xFF) as usize];
+        }
+        crc
+    }
+
+    #[inline(always)]
+    fn load_u64(data: &[u8], offset: usize) -> u64 {
+        let mut bytes = [0u8; 8];
+        bytes.copy_from_slice(&data[offset..offset + 8]);
+        u64::from_le_bytes(bytes)
+    }
+
+    // Donanım CRC komutu (`step8`/`step1`) ile üç akışlı CRC32C. Akışlar birbirinden bağımsız olduğundan
+    // komut gecikmesi örtüşür; her 3 * LANE byte'ta kayıtlar LANE_SHIFT çarpanıyla birleştirilir.
+    #[inline(always)]
+    fn crc32c_interleaved(mut crc: u32, data: &[u8], step8: impl Fn(u32, u64) -> u32, step1: impl Fn(u32, u8) -> u32) -> u32 {
+        let mut offset = 0;
+        while data.len() - offset >= 3 * LANE {
+            let (mut a, mut b, mut c) = (crc, 0u32, 0u32);
+            let mut i = 0;
+            while i < LANE {
+                a = step8(a, load_u64(data, offset + i));
+                b = step8(b, load_u64(data, offset + LANE + i));
+                c = step8(c, load_u64(data, offset + 2 * LANE + i));
+                i += 8;
+            }
+            crc = multmodp(LANE_SHIFT, multmodp(LANE_SHIFT, a) ^ b) ^ c;
+            offset += 3 * LANE;
+        }
+        while data.len() - offset >= 8 {
+            crc = step8(crc, load_u64(data, offset));
+            offset += 8;
+        }
+        for &byte in &data[offset..] {
+            crc = step1(crc, byte);
+        }
+        crc
+    }
+
+    #[cfg(target_arch = "x86_64")]
+    #[target_feature(enable = "sse4.2")]
+    unsafe fn crc32c_sse42_raw(crc: u32, data: &[u8]) -> u32 {
+        use core::arch::x86_64::{_mm_crc32_u64, _mm_crc32_u8};
+        crc32c_interleaved(crc, data, |c, v| _mm_crc32_u64(c as u64, v) as u32, |c, b| _mm_crc32_u8(c, b))
+    }
+
+    #[cfg(target_arch = "aarch64")]
+    #[target_feature(enable = "crc")]
+    unsafe fn crc32c_arm_raw(crc: u32, data: &[u8]) -> u32 {
+        use core::arch::aarch64::{__crc32cd, __crc32cb};
+        crc32c_interleaved(crc, data, |c, v| __crc32cd(c, v), |c, b| __crc32cb(c, b))
+    }
+
+    // Seçilen çekirdek + 1 (0: henüz seçilmedi)
+    static SELECTED: AtomicU8 = AtomicU8::new(0);
+    // Kullanılabilir çekirdek maskesi (0: henüz yoklanmadı; skaler bit her zaman 1 olduğundan geçerli maske 0 olamaz)
+    static AVAILABLE: AtomicU32 = AtomicU32::new(0);
+
+    /// Bu işlemcide kullanılabilir CRC32C çekirdekleri (bit `1 << KERNEL_*`).
+    /// İlk çağrıda yoklanır (x86_64'te cpuid, aarch64'te sistem çağrısı) ve sonuç önbelleğe alınır.
+    pub fn available_kernels() -> u32 {
+        let cached = AVAILABLE.load(Ordering::Relaxed);
+        if cached != 0 {
+            return cached;
+        }
+        let mask = probe_kernels();
+        AVAILABLE.store(mask, Ordering::Relaxed);
+        mask
+    }
+
+    fn probe_kernels() -> u32 {
+        let mut mask = 1 << KERNEL_SCALAR;
+        #[cfg(target_arch = "x86_64")]
+        {
+            // CPUID.01H:ECX.SSE4_2[bit 20]
+            let leaf1 = unsafe { core::arch::x86_64::__cpuid(1) };
+            if leaf1.ecx & (1 << 20) != 0 {
+                mask |= 1 << KERNEL_SSE42;
+            }
+        }
+        #[cfg(target_arch = "aarch64")]
+        {
+            // aarch64'te özellik kayıtları kullanıcı alanından okunamaz; çekirdek bildirir
+            if let Ok(features) = kernel::get_info(kernel::KERNEL_INFO_CPU_FEATURES) {
+                if features & kernel::CPU_FEATURE_ARM_CRC32 != 0 {
+                    mask |= 1 << KERNEL_ARM_CRC;
+                }
+            }
+        }
+        mask
+    }
+
+    /// Çalışma zamanında seçilen (kullanılabilir en hızlı) CRC32C çekirdeği.
+    pub fn active_kernel() -> u32 {
+        let selected = SELECTED.load(Ordering::Relaxed);
+        if selected != 0 {
+            return (selected - 1) as u32;
+        }
+        let mask = available_kernels();
+        let kernel = if mask & (1 << KERNEL_SSE42) != 0 {
+            KERNEL_SSE42
+        } else if mask & (1 << KERNEL_ARM_CRC) != 0 {
+            KERNEL_ARM_CRC
+        } else {
+            KERNEL_SCALAR
+        };
+        SELECTED.store(kernel as u8 + 1, Ordering::Relaxed);
+        kernel
+    }
+
+    /// Belirli bir çekirdekle CRC32C hesaplar (karşılaştırma/ölçüm için). `crc` önceki sonuçtur (başlangıçta 0);
+    /// böylece veri parça parça işlenebilir. Çekirdek bu işlemcide yoksa NotSupported döner.
+    pub fn crc32c_with(kernel: u32, crc: u32, data: &[u8]) -> Result<u32, SahneError> {
+        if kernel >= 32 || available_kernels() & (1 << kernel) == 0 {
+            return Err(SahneError::NotSupported);
+        }
+        Ok(!unsafe { crc32c_raw(kernel, !crc, data) })
+    }
+
+    // Güvenlik: `kernel` available_kernels() içinde olmalıdır (donanım komutları başka türlü tanımsızdır).
+    #[inline(always)]
+    unsafe fn crc32c_raw(kernel: u32, raw: u32, data: &[u8]) -> u32 {
+        match kernel {
+            #[cfg(target_arch = "x86_64")]
+            KERNEL_SSE42 => crc32c_sse42_raw(raw, data),
+            #[cfg(target_arch = "aarch64")]
+            KERNEL_ARM_CRC => crc32c_arm_raw(raw, data),
+            _ => crc32c_scalar_raw(raw, data),
+        }
+    }
+
+    /// CRC32C hesaplar; `crc` önceki sonuçtur (başlangıçta 0). Çekirdek bir kez seçilir, sonraki çağrılar
+    /// yalnızca önbellekteki seçimi okur.
+    pub fn crc32c(crc: u32, data: &[u8]) -> u32 {
+        // Güvenlik: active_kernel() yalnızca available_kernels() içindeki bir çekirdeği seçer
+        !unsafe { crc32c_raw(active_kernel(), !crc, data) }
+    }
+
+    /// crc1 = crc32c(0, A), crc2 = crc32c(0, B) iken crc32c(0, A || B)'yi veriyi yeniden okumadan hesaplar
+    /// (örn. yan dosyadaki blok CRC'lerinden tüm akışın CRC'si). `len2`: B'nin uzunluğu.
+    pub fn crc32c_combine(crc1: u32, crc2: u32, len2: u64) -> u32 {
+        multmodp(x8nmodp(len2), crc1) ^ crc2
+    }
+
+    // --- xxHash64 ---
+    const P1: u64 = 0x9E37_79B1_85EB_CA87;
+    const P2: u64 = 0xC2B2_AE3D_27D4_EB4F;
+    const P3: u64 = 0x1656_67B1_9E37_79F9;
+    const P4: u64 = 0x85EB_CA77_C2B2_AE63;
+    const P5: u64 = 0x27D4_EB2F_1656_67C5;
+
+    #[inline(always)]
+    fn xxh_round(acc: u64, input: u64) -> u64 {
+        acc.wrapping_add(input.wrapping_mul(P2)).rotate_left(31).wrapping_mul(P1)
+    }
+
+    #[inline(always)]
+    fn xxh_merge(acc: u64, val: u64) -> u64 {
+        (acc ^ xxh_round(0, val)).wrapping_mul(P1).wrapping_add(P4)
+    }
+
+    /// xxHash64 hesaplar.
+    pub fn xxhash64(data: &[u8], seed: u64) -> u64 {
+        let len = data.len();
+        let mut offset = 0;
+        let mut h = if len >= 32 {
+            let mut v1 = seed.wrapping_add(P1).wrapping_add(P2);
+            let mut v2 = seed.wrapping_add(P2);
+            let mut v3 = seed;
+            let mut v4 = seed.wrapping_sub(P1);
+            while len - offset >= 32 {
+                v1 = xxh_round(v1, load_u64(data, offset));
+                v2 = xxh_round(v2, load_u64(data, offset + 8));
+                v3 = xxh_round(v3, load_u64(data, offset + 16));
+                v4 = xxh_round(v4, load_u64(data, offset + 24));
+                offset += 32;
+            }
+            let mut h = v1.rotate_left(1).wrapping_add(v2.rotate_left(7)).wrapping_add(v3.rotate_left(12)).wrapping_add(v4.rotate_left(18));
+            h = xxh_merge(h, v1);
+            h = xxh_merge(h, v2);
+            h = xxh_merge(h, v3);
+            xxh_merge(h, v4)
+        } else {
+            seed.wrapping_add(P5)
+        };
+        h = h.wrapping_add(len as u64);
+        while len - offset >= 8 {
+            h ^= xxh_round(0, load_u64(data, offset));
+            h = h.rotate_left(27).wrapping_mul(P1).wrapping_add(P4);
+            offset += 8;
+        }
+        if len - offset >= 4 {
+            let v = u32::from_le_bytes([data[offset], data[offset + 1], data[offset + 2], data[offset + 3]]) as u64;
+            h ^= v.wrapping_mul(P1);
+            h = h.rotate_left(23).wrapping_mul(P2).wrapping_add(P3);
+            offset += 4;
+        }
+        while offset < len {
+            h ^= (data[offset] as u64).wrapping_mul(P5);
+            h = h.rotate_left(11).wrapping_mul(P1);
+            offset += 1;
+        }
+        h ^= h >> 33;
+        h = h.wrapping_mul(P2);
+        h ^= h >> 29;
+        h = h.wrapping_mul(P3);
+        h ^ (h >> 32)
+    }
+
+    /// Bir bloğun `algorithm` (CRC32C / XXHASH64) ile sağlama toplamı.
+    pub fn block_checksum(algorithm: u16, data: &[u8]) -> Result<u64, SahneError> {
+        match algorithm {
+            CRC32C => Ok(crc32c(0, data) as u64),
+            XXHASH64 => Ok(xxhash64(data, 0)),
+            _ => Err(SahneError::InvalidParameter),
+        }
+    }
+
+    // --- Blok aşaması ---
+
+    fn write_all(handle: Handle, mut data: &[u8]) -> Result<(), SahneError> {
+        while !data.is_empty() {
+            let n = resource::write(handle, data)?;
+            if n == 0 {
+                return Err(SahneError::InvalidOperation);
+            }
+            data = &data[n..];
+        }
+        Ok(())
+    }
+
+    fn read_full(handle: Handle, buffer: &mut [u8]) -> Result<usize, SahneError> {
+        let mut filled = 0;
+        while filled < buffer.len() {
+            let n = resource::read(handle, &mut buffer[filled..])?;
+            if n == 0 {
+                break; // Kaynağın sonu
+            }
+            filled += n;
+        }
+        Ok(filled)
+    }
+
+    /// Veriyi `block` uzunluğunda bloklar halinde `data` kaynağına yazan ve her bloğun sağlama toplamını
+    /// (varsa) yan dosyaya ekleyen aşama.
+    pub struct BlockWriter<'a> {
+        data: Handle,
+        sidecar: Option<Handle>,
+        algorithm: u16,
+        block: &'a mut [u8],
+        fill: usize,
+        blocks: u64,
+    }
+
+    impl<'a> BlockWriter<'a> {
+        /// `block`: blok tamponu; uzunluğu blok boyutudur. `sidecar` verilirse başına başlık yazılır.
+        pub fn new(data: Handle, sidecar: Option<Handle>, algorithm: u16, block: &'a mut [u8]) -> Result<Self, SahneError> {
+            if block.is_empty() || block.len() > u32::MAX as usize || (algorithm != CRC32C && algorithm != XXHASH64) {
+                return Err(SahneError::InvalidParameter);
+            }
+            if let Some(sidecar) = sidecar {
+                let header = SidecarHeader {
+                    magic: SIDECAR_MAGIC,
+                    version: SIDECAR_VERSION,
+                    algorithm,
+                    block_size: block.len() as u32,
+                    reserved: 0,
+                };
+                let bytes = unsafe {
+                    core::slice::from_raw_parts(&header as *const SidecarHeader as *const u8, SIDECAR_HEADER_SIZE as usize)
+                };
+                write_all(sidecar, bytes)?;
+            }
+            Ok(BlockWriter { data, sidecar, algorithm, block, fill: 0, blocks: 0 })
+        }
+
+        pub fn write(&mut self, mut bytes: &[u8]) -> Result<(), SahneError> {
+            while !bytes.is_empty() {
+                let n = bytes.len().min(self.block.len() - self.fill);
+                self.block[self.fill..self.fill + n].copy_from_slice(&bytes[..n]);
+                self.fill += n;
+                bytes = &bytes[n..];
+                if self.fill == self.block.len() {
+                    self.flush_block()?;
+                }
+            }
+            Ok(())
+        }
 
+        /// Kalan kısmi bloğu yazar ve yazılan blok sayısını döner.
+        pub fn finish(mut self) -> Result<u64, SahneError> {
+            if self.fill != 0 {
+                self.flush_block()?;
+            }
+            Ok(self.blocks)
+        }
 
-    /// (Yeni Özellik) PollEntry struct'ı: Poll çağrısı için tek bir handle girişi
-    #[derive(Debug, Copy, Clone, PartialEq, Eq)]
-    #[repr(C)] // C ABI uyumu (syscall ile array olarak geçecek)
-    pub struct PollEntry {
-        pub handle: Handle,         // Beklenecek handle
-        pub events_in: PollEventFlags, // Beklenen olaylar (input)
-        pub events_out: PollEventFlags, // Gerçekleşen olaylar (output, çekirdek doldurur)
+        fn flush_block(&mut self) -> Result<(), SahneError> {
+            let block = &self.block[..self.fill];
+            let sum = block_checksum(self.algorithm, block)?;
+            write_all(self.data, block)?;
+            if let Some(sidecar) = self.sidecar {
+                write_all(sidecar, &sum.to_le_bytes())?;
+            }
+            self.fill = 0;
+            self.blocks += 1;
+            Ok(())
+        }
     }
 
-    /// (Yeni Özellik) Birden çok handle üzerinde belirli olayların gerçekleşmesini bekler.
-    /// `entries`: Beklenecek handle'lar ve beklenen olayları içeren PollEntry dizisi.
-    ///            Çekirdek bu diziyi güncelleyerek gerçekleşen olayları `events_out` alanına yazar.
-    /// `timeout`: Ne kadar bekleneceği. None ise sonsuza kadar bekler. Some(Duration) ise belirtilen süre kadar bekler.
-    /// Başarı durumunda, olay gerçekleşen (events_out != NONE) entry sayısını döner.
-    pub fn poll(entries: &mut [PollEntry], timeout: Option<Duration>) -> Result<usize, SahneError> {
-        let entries_ptr = entries.as_mut_ptr() as u64;
-        let entries_len = entries.len() as u64;
-        let timeout_ms = match timeout {
-            Some(d) => d.as_millis() as i64, // ms olarak i64'e çevir
-            None => -1, // Sonsuz bekleme için özel değer (Unix poll'daki -1 gibi)
-        };
+    /// Yan dosyanın başlığını okur ve doğrular.
+    pub fn read_sidecar_header(sidecar: Handle) -> Result<SidecarHeader, SahneError> {
+        let mut bytes = [0u8; SIDECAR_HEADER_SIZE as usize];
+        resource::seek(sidecar, resource::SeekFrom::Start(0))?;
+        if read_full(sidecar, &mut bytes)? != bytes.len() {
+            return Err(SahneError::InvalidOperation);
+        }
+        let header = unsafe { core::ptr::read_unaligned(bytes.as_ptr() as *const SidecarHeader) };
+        if header.magic != SIDECAR_MAGIC || header.version != SIDECAR_VERSION || header.block_size == 0 {
+            return Err(SahneError::InvalidOperation);
+        }
+        Ok(header)
+    }
 
-        // Syscall argümanları (handle listesi pointer/uzunluk, timeout)
-        let result = unsafe {
-            syscall(arch::SYSCALL_POLL, entries_ptr, entries_len, timeout_ms as u64, 0, 0)
-        };
+    /// `index` numaralı bloğu okur ve yan dosyadaki sağlama toplamıyla doğrular.
+    /// `buffer` en az `header.block_size` uzunluğunda olmalıdır. Okunan byte sayısını döner
+    /// (son blok kısa olabilir); uyuşmazlıkta ChecksumMismatch döner.
+    pub fn read_verified_block(data: Handle, sidecar: Handle, header: &SidecarHeader, index: u64, buffer: &mut [u8]) -> Result<usize, SahneError> {
+        let block_size = header.block_size as usize;
+        if buffer.len() < block_size {
+            return Err(SahneError::InvalidParameter);
+        }
+        resource::seek(data, resource::SeekFrom::Start(index * block_size as u64))?;
+        let n = read_full(data, &mut buffer[..block_size])?;
+        let mut stored = [0u8; 8];
+        resource::seek(sidecar, resource::SeekFrom::Start(SIDECAR_HEADER_SIZE + index * 8))?;
+        if read_full(sidecar, &mut stored)? != stored.len() {
+            return Err(SahneError::ChecksumMismatch); // Blok için kayıt yok
+        }
+        if block_checksum(header.algorithm, &buffer[..n])? != u64::from_le_bytes(stored) {
+            return Err(SahneError::ChecksumMismatch);
+        }
+        Ok(n)
+    }
+}
 
-        if result < 0 {
-            Err(map_kernel_error(result)) // Hata (örn. Interrupted, InvalidArgument)
-        } else {
-            // Başarı durumunda, olay gerçekleşen entry sayısı döner.
-            // Çekirdek, `entries` dizisindeki `events_out` alanlarını doldurmuş olmalıdır.
-            Ok(result as usize)
+// Yeni bir modül: Paylaşımlı bellek üzerinde tek yazıcılı, çok okuyuculu yayın (broadcast) kanalı
+// Bir mesajı N aboneye göndermek N kez messaging::send (N çekirdek kopyası) yerine halkaya tek bir yazmadır.
+// Düzen sahne.h SahneBroadcastHeader_t / SahneBroadcastSlot_t ile aynıdır (sahne_broadcast.hpp ile ortak).
+// Her yuva bir seqlock'tur: yazıcı yuvayı 2n+1 ile işaretler, veriyi yazar, 2n+2 ile yayınlar.
+// Okuyucular imleçlerini yerel tutar; yazıcı hiçbir zaman okuyucuyu beklemez. Geride kalan okuyucu
+// SahneError::Lagged alır ve imleci halkadaki en eski geçerli mesaja taşınır.
+// Uyandırma: yazıcı yalnızca park etmiş okuyucu varsa (waiters != 0) tek bir memory::notify_shared yapar;
+// okuyucular memory::watch_shared handle'ı üzerinde poll eder (kendi poll kümelerine de ekleyebilirler).
+pub mod broadcast {
+    use super::{SahneError, Handle, memory, poll, resource};
+    use core::ptr::NonNull;
+    use core::sync::atomic::{fence, AtomicU32, AtomicU64, Ordering};
+    use core::time::Duration;
+
+    pub const MAGIC: u32 = 0x5453_4342; // "BCST"
+    pub const VERSION: u16 = 1;
+    pub const SLOT_ALIGN: usize = 64;
+    pub const SLOT_HEADER_SIZE: usize = core::mem::size_of::<SlotHeader>();
+
+    /// sahne.h SahneBroadcastHeader_t ile aynı düzen.
+    #[repr(C)]
+    pub struct Header {
+        magic: u32,
+        version: u16,
+        reserved: u16,
+        slot_count: u32,
+        slot_size: u32,
+        _pad0: [u8; 48],
+        write_seq: AtomicU64,
+        _pad1: [u8; 56],
+        waiters: AtomicU32,
+        closed: AtomicU32,
+        _pad2: [u8; 56],
+    }
+
+    /// sahne.h SahneBroadcastSlot_t ile aynı düzen.
+    #[repr(C)]
+    struct SlotHeader {
+        seq: AtomicU64,
+        len: AtomicU32,
+        reserved: u32,
+    }
+
+    /// `slot_count` yuva ve en fazla `max_message` byte'lık mesajlar için yuva boyutu.
+    pub fn slot_size_for(max_message: usize) -> usize {
+        (SLOT_HEADER_SIZE + max_message + SLOT_ALIGN - 1) & !(SLOT_ALIGN - 1)
+    }
+
+    /// Paylaşımlı bellek bölgesinin toplam boyutu.
+    pub fn region_size(slot_count: usize, max_message: usize) -> usize {
+        core::mem::size_of::<Header>() + slot_count * slot_size_for(max_message)
+    }
+
+    struct Ring {
+        base: NonNull<u8>,
+        size: usize,
+        mask: u64,
+        slot_size: usize,
+    }
+
+    impl Ring {
+        fn header(&self) -> &Header {
+            unsafe { &*(self.base.as_ptr() as *const Header) }
+        }
+
+        fn slot(&self, seq: u64) -> (&SlotHeader, *mut u8) {
+            let offset = core::mem::size_of::<Header>() + (seq & self.mask) as usize * self.slot_size;
+            unsafe {
+                let p = self.base.as_ptr().add(offset);
+                (&*(p as *const SlotHeader), p.add(SLOT_HEADER_SIZE))
+            }
+        }
+
+        fn max_message(&self) -> usize {
+            self.slot_size - SLOT_HEADER_SIZE
+        }
+
+        fn unmap(&self) -> Result<(), SahneError> {
+            memory::unmap_shared(self.base, self.size)
+        }
+    }
+
+    /// Yayın kanalının tek yazıcısı.
+    pub struct Sender {
+        shm: Handle,
+        ring: Ring,
+    }
+
+    // Eşleme görevin tüm iş parçacıklarında geçerlidir; paylaşılan alanlara yalnızca atomiklerle erişilir.
+    unsafe impl Send for Sender {}
+    unsafe impl Send for Receiver {}
+
+    impl Sender {
+        /// `slot_count` (2'nin kuvveti, >= 2) yuvalı, en fazla `max_message` byte'lık mesajlar taşıyan
+        /// bir kanal oluşturur. Aboneler `handle()` ile dönen paylaşımlı bellek handle'ını
+        /// (örn. messaging::send_with_handles ile) alıp `Receiver::attach` çağırır.
+        pub fn create(slot_count: u32, max_message: u32) -> Result<Sender, SahneError> {
+            if slot_count < 2 || !slot_count.is_power_of_two() || max_message == 0 {
+                return Err(SahneError::InvalidParameter);
+            }
+            let slot_size = slot_size_for(max_message as usize);
+            if slot_size > u32::MAX as usize {
+                return Err(SahneError::InvalidParameter);
+            }
+            let size = region_size(slot_count as usize, max_message as usize);
+            let shm = memory::create_shared(size)?;
+            let base = match memory::map_shared(shm, 0, size) {
+                Ok(base) => base,
+                Err(e) => {
+                    let _ = resource::release(shm);
+                    return Err(e);
+                }
+            };
+            unsafe {
+                // Yeni paylaşımlı bellek sıfırlı gelir; yuvaların seq değeri 0 = "hiç yazılmadı"
+                let header = base.as_ptr() as *mut Header;
+                (*header).slot_count = slot_count;
+                (*header).slot_size = slot_size as u32;
+                (*header).version = VERSION;
+                fence(Ordering::Release);
+                core::ptr::write_volatile(&mut (*header).magic, MAGIC); // En son: abonelere "hazır"
+            }
+            Ok(Sender { shm, ring: Ring { base, size, mask: slot_count as u64 - 1, slot_size } })
+        }
+
+        /// Abonelere dağıtılacak paylaşımlı bellek handle'ı.
+        pub fn handle(&self) -> Handle {
+            self.shm
+        }
+
+        pub fn max_message(&self) -> usize {
+            self.ring.max_message()
+        }
+
+        /// Mesajı yayınlar ve sıra numarasını döner. Hiçbir zaman okuyucuları beklemez;
+        /// en yavaş okuyucudan `slot_count - 1` mesaj öndeyse o okuyucu Lagged alır.
+        pub fn send(&mut self, data: &[u8]) -> Result<u64, SahneError> {
+            if data.len() > self.ring.max_message() {
+                return Err(SahneError::InvalidParameter);
+            }
+            let header = self.ring.header();
+            let n = header.write_seq.load(Ordering::Relaxed); // Yalnızca bu yazıcı değiştirir
+            let (slot, payload) = self.ring.slot(n);
+            slot.seq.store(2 * n + 1, Ordering::Relaxed);
+            fence(Ordering::Release); // Veri yazmaları "yazılıyor" işaretinden önce görünmesin
+            unsafe { core::ptr::copy_nonoverlapping(data.as_ptr(), payload, data.len()); }
+            slot.len.store(data.len() as u32, Ordering::Relaxed);
+            slot.seq.store(2 * n + 2, Ordering::Release);
+            header.write_seq.store(n + 1, Ordering::Release);
+            self.wake(n + 1)?;
+            Ok(n)
+        }
+
+        /// Kanalı kapatır: okuyucular kalan mesajları okuduktan sonra Disconnected alır.
+        pub fn close(self) -> Result<(), SahneError> {
+            let header = self.ring.header();
+            header.closed.store(1, Ordering::Release);
+            let wake = self.wake(header.write_seq.load(Ordering::Relaxed));
+            let unmap = self.ring.unmap();
+            let release = resource::release(self.shm);
+            wake.and(unmap).and(release)
+        }
+
+        fn wake(&self, value: u64) -> Result<(), SahneError> {
+            // waiters okuması yayından sonra sıralanmalı (okuyucu tarafındaki SeqCst artırma ile eşleşir)
+            fence(Ordering::SeqCst);
+            if self.ring.header().waiters.load(Ordering::Relaxed) != 0 {
+                memory::notify_shared(self.shm, value)?;
+            }
+            Ok(())
+        }
+    }
+
+    /// Yayın kanalının bir abonesi (okuyucu). Her okuyucu kendi imlecini tutar.
+    pub struct Receiver {
+        ring: Ring,
+        watch: Handle,
+        cursor: u64,
+        missed: u64,
+    }
+
+    impl Receiver {
+        /// `shm` yayın kanalının paylaşımlı bellek handle'ıdır; sahipliği çağıranda kalır.
+        /// Okuyucu şu andan sonra yayınlanan mesajları alır.
+        pub fn attach(shm: Handle) -> Result<Receiver, SahneError> {
+            let header_size = core::mem::size_of::<Header>();
+            let probe = memory::map_shared(shm, 0, header_size)?;
+            let (slot_count, slot_size, valid) = unsafe {
+                let header = &*(probe.as_ptr() as *const Header);
+                let valid = core::ptr::read_volatile(&header.magic) == MAGIC;
+                fence(Ordering::Acquire);
+                (header.slot_count, header.slot_size as usize, valid && header.version == VERSION)
+            };
+            memory::unmap_shared(probe, header_size)?;
+            if !valid || slot_count < 2 || !slot_count.is_power_of_two()
+                || slot_size <= SLOT_HEADER_SIZE || slot_size % SLOT_ALIGN != 0 {
+                return Err(SahneError::InvalidOperation);
+            }
+            let size = header_size + slot_count as usize * slot_size;
+            let base = memory::map_shared(shm, 0, size)?;
+            let ring = Ring { base, size, mask: slot_count as u64 - 1, slot_size };
+            let watch = match memory::watch_shared(shm) {
+                Ok(watch) => watch,
+                Err(e) => {
+                    let _ = ring.unmap();
+                    return Err(e);
+                }
+            };
+            let cursor = ring.header().write_seq.load(Ordering::Acquire);
+            Ok(Receiver { ring, watch, cursor, missed: 0 })
+        }
+
+        /// Poll kümelerine eklenebilecek izleme handle'ı (yeni mesaj bildiriminde READABLE).
+        /// Yazıcı yalnızca park etmiş okuyucu varken bildirim yapar; kendi poll döngüsünü kullanan
+        /// okuyucu `recv` kullanmalı veya `try_recv` WouldBlock döndükten sonra poll etmelidir.
+        pub fn watch_handle(&self) -> Handle {
+            self.watch
+        }
+
+        pub fn max_message(&self) -> usize {
+            self.ring.max_message()
+        }
+
+        /// Şimdiye kadar geride kalınarak kaçırılan toplam mesaj sayısı.
+        pub fn missed(&self) -> u64 {
+            self.missed
+        }
+
+        /// Henüz okunmamış mesaj sayısı (halka kapasitesini aşabilir; o durumda bir sonraki okuma Lagged döner).
+        pub fn pending(&self) -> u64 {
+            self.ring.header().write_seq.load(Ordering::Acquire).saturating_sub(self.cursor)
+        }
+
+        /// Bekleyen bir mesajı `buf`'a kopyalar ve uzunluğunu döner.
+        /// - WouldBlock: yeni mesaj yok.
+        /// - Lagged: mesajların üzerine yazıldı; imleç en eski geçerli mesaja taşındı (`missed` güncellenir),
+        ///   bir sonraki çağrı oradan devam eder.
+        /// - Disconnected: yazıcı kapandı ve tüm mesajlar okundu.
+        /// - InvalidParameter: `buf` mesaj için küçük (mesaj tüketilmez).
+        pub fn try_recv(&mut self, buf: &mut [u8]) -> Result<usize, SahneError> {
+            let header = self.ring.header();
+            let closed = header.closed.load(Ordering::Acquire) != 0;
+            let head = header.write_seq.load(Ordering::Acquire);
+            if self.cursor >= head {
+                return Err(if closed { SahneError::Disconnected } else { SahneError::WouldBlock });
+            }
+            if head - self.cursor > self.ring.mask {
+                return Err(self.skip_lagged());
+            }
+            let expected = 2 * self.cursor + 2;
+            let (slot, payload) = self.ring.slot(self.cursor);
+            if slot.seq.load(Ordering::Acquire) != expected {
+                return Err(self.skip_lagged()); // Yazıcı bu yuvayı yeniden kullanmaya başladı
+            }
+            let len = slot.len.load(Ordering::Relaxed) as usize;
+            if len > self.ring.max_message() {
+                return Err(self.skip_lagged()); // Yarım yazılmış yuva
+            }
+            if len > buf.len() {
+                return Err(SahneError::InvalidParameter);
+            }
+            unsafe { core::ptr::copy_nonoverlapping(payload as *const u8, buf.as_mut_ptr(), len); }
+            fence(Ordering::Acquire);
+            if slot.seq.load(Ordering::Relaxed) != expected {
+                return Err(self.skip_lagged()); // Kopyalama sırasında üzerine yazıldı
+            }
+            self.cursor += 1;
+            Ok(len)
+        }
+
+        /// `try_recv` gibi, ancak mesaj yoksa izleme handle'ı üzerinde bekler.
+        /// `timeout` her bekleme için uygulanır; None sonsuz bekler. Süre dolarsa TimedOut döner.
+        pub fn recv(&mut self, buf: &mut [u8], timeout: Option<Duration>) -> Result<usize, SahneError> {
+            loop {
+                match self.try_recv(buf) {
+                    Err(SahneError::WouldBlock) => {}
+                    other => return other,
+                }
+                self.ring.header().waiters.fetch_add(1, Ordering::SeqCst);
+                // Artırmadan sonra tekrar kontrol et: yazıcı bizi görmeden yayın yapmış olabilir
+                let retry = self.try_recv(buf);
+                if !matches!(retry, Err(SahneError::WouldBlock)) {
+                    self.ring.header().waiters.fetch_sub(1, Ordering::SeqCst);
+                    return retry;
+                }
+                let mut entries = [poll::PollEntry {
+                    handle: self.watch,
+                    events_in: poll::PollEventFlags::READABLE,
+                    events_out: poll::PollEventFlags::NONE,
+                }];
+                let ready = poll::poll(&mut entries, timeout);
+                self.ring.header().waiters.fetch_sub(1, Ordering::SeqCst);
+                match ready {
+                    Ok(0) => return Err(SahneError::TimedOut),
+                    Ok(_) => { memory::read_watch(self.watch)?; }
+                    Err(e) => return Err(e),
+                }
+            }
+        }
+
+        /// Okuyucuyu ayırır (eşlemeyi ve izleme handle'ını bırakır). Paylaşımlı bellek handle'ı çağıranda kalır.
+        pub fn detach(self) -> Result<(), SahneError> {
+            let unmap = self.ring.unmap();
+            unmap.and(resource::release(self.watch))
+        }
+
+        fn skip_lagged(&mut self) -> SahneError {
+            // Yazılmakta olan yuva (head) ile aynı yuvaya düşmemek için head - slot_count + 1'den devam edilir
+            let head = self.ring.header().write_seq.load(Ordering::Acquire);
+            let oldest = head.saturating_sub(self.ring.mask);
+            let next = if oldest > self.cursor { oldest } else { self.cursor + 1 };
+            self.missed += next - self.cursor;
+            self.cursor = next;
+            SahneError::Lagged
         }
     }
 }
@@ -826,6 +3194,11 @@ pub use kernel;
 pub use sync;
 pub use messaging;
 pub use poll; // Yeni polling modülü
+pub use timer;
+pub use rpc;
+pub use walk;
+pub use checksum;
+pub use broadcast;
 pub use {Handle, TaskId, SahneError}; // Export Rust-idiomatic types
 
 // C API hata tipi de Rust tarafından kullanılabilir hale getirilebilir (isteğe bağlı)
@@ -850,6 +3223,419 @@ pub extern "C" fn sahne_resource_seek(handle: u64, whence: u64, offset: i64) ->
     }
 }
 
+// SahneError -> sahne.h SAHNE_ERROR_* kodu dönüşümü (C wrapper'ları için)
+fn map_sahne_error_to_c(e: SahneError) -> i32 {
+    match e {
+        SahneError::OutOfMemory => 1,
+        SahneError::InvalidAddress => 2,
+        SahneError::InvalidParameter => 3,
+        SahneError::ResourceNotFound => 4,
+        SahneError::PermissionDenied => 5,
+        SahneError::ResourceBusy => 6,
+        SahneError::Interrupted => 7,
+        SahneError::NoMessage => 8,
+        SahneError::InvalidOperation => 9,
+        SahneError::NotSupported => 10,
+        SahneError::UnknownSystemCall => 11,
+        SahneError::TaskCreationFailed => 12,
+        SahneError::InvalidHandle => 13,
+        SahneError::HandleLimitExceeded => 14,
+        SahneError::NamingError => 15,
+        SahneError::CommunicationError => 16,
+        SahneError::WouldBlock => 17,
+        SahneError::Disconnected => 18,
+        SahneError::TimedOut => 19,
+        SahneError::ChecksumMismatch => 20,
+        SahneError::Lagged => 21,
+    }
+}
+
+// SahneError -> negatif çekirdek kodu (kerror_t), map_kernel_error'ın tersi. sahne_poll gibi
+// sonucu doğrudan çekirdek sözleşmesiyle (>= 0 başarı, < 0 kerror_t) dönen C wrapper'ları için.
+fn map_sahne_error_to_kernel(e: SahneError) -> i64 {
+    match e {
+        SahneError::PermissionDenied => -1,
+        SahneError::ResourceNotFound => -2,
+        SahneError::InvalidParameter => -3,
+        SahneError::Interrupted => -4,
+        SahneError::InvalidHandle => -9,
+        SahneError::ResourceBusy => -11,
+        SahneError::OutOfMemory => -12,
+        SahneError::InvalidAddress => -14,
+        SahneError::NamingError => -17,
+        SahneError::NotSupported => -38,
+        SahneError::NoMessage => -61,
+        SahneError::ChecksumMismatch => -74,
+        SahneError::WouldBlock => -101,
+        SahneError::Disconnected => -102,
+        SahneError::TimedOut => -110,
+        _ => -38, // Çekirdek karşılığı olmayan hatalar
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_channel_send_many(channel_handle: u64, frames_ptr: *const u8, frames_len: usize, out_sent_count: *mut usize) -> i32 {
+    if (frames_ptr.is_null() && frames_len != 0) || out_sent_count.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let frames = if frames_len == 0 { &[][..] } else { unsafe { core::slice::from_raw_parts(frames_ptr, frames_len) } };
+    match messaging::send_many(Handle(channel_handle), frames) {
+        Ok(sent) => { unsafe { *out_sent_count = sent; } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_channel_receive_many(channel_handle: u64, buffer_ptr: *mut u8, buffer_len: usize,
+                                             spans: *mut messaging::MessageSpan, max_spans: usize, out_count: *mut usize) -> i32 {
+    if buffer_ptr.is_null() || spans.is_null() || out_count.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let buffer = unsafe { core::slice::from_raw_parts_mut(buffer_ptr, buffer_len) };
+    let spans = unsafe { core::slice::from_raw_parts_mut(spans, max_spans) };
+    match messaging::receive_many(Handle(channel_handle), buffer, spans) {
+        Ok(count) => { unsafe { *out_count = count; } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_channel_send_with_handles(channel_handle: u64, message_ptr: *const u8, message_len: usize,
+                                                  handles_ptr: *const Handle, handles_len: usize) -> i32 {
+    if (message_ptr.is_null() && message_len != 0) || (handles_ptr.is_null() && handles_len != 0) {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let message = if message_len == 0 { &[][..] } else { unsafe { core::slice::from_raw_parts(message_ptr, message_len) } };
+    let handles = if handles_len == 0 { &[][..] } else { unsafe { core::slice::from_raw_parts(handles_ptr, handles_len) } };
+    match messaging::send_with_handles(Handle(channel_handle), message, handles) {
+        Ok(()) => 0,
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_channel_receive_with_handles(channel_handle: u64, envelope: *mut messaging::Envelope) -> i32 {
+    if envelope.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let env = unsafe { &mut *envelope };
+    if (env.data.is_null() && env.data_cap != 0) || (env.handles.is_null() && env.handles_cap != 0) {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let buffer = if env.data_cap == 0 { &mut [][..] } else { unsafe { core::slice::from_raw_parts_mut(env.data, env.data_cap) } };
+    let handles = if env.handles_cap == 0 { &mut [][..] } else { unsafe { core::slice::from_raw_parts_mut(env.handles, env.handles_cap) } };
+    match messaging::receive_with_handles(Handle(channel_handle), buffer, handles) {
+        Ok((bytes, count)) => { env.data_len = bytes; env.handles_len = count; 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_task_get_initial_handles(out_handles: *mut Handle, max_handles: usize, out_count: *mut usize) -> i32 {
+    if (out_handles.is_null() && max_handles != 0) || out_count.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let out = if max_handles == 0 { &mut [][..] } else { unsafe { core::slice::from_raw_parts_mut(out_handles, max_handles) } };
+    match task::initial_handles(out) {
+        Ok(count) => { unsafe { *out_count = count; } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_task_template_create(code_handle: u64, args_ptr: *const u8, args_len: usize,
+                                             initial_handles_ptr: *const Handle, initial_handles_len: usize,
+                                             out_template_handle: *mut u64) -> i32 {
+    if (args_ptr.is_null() && args_len != 0) || (initial_handles_ptr.is_null() && initial_handles_len != 0) || out_template_handle.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let args = if args_len == 0 { &[][..] } else { unsafe { core::slice::from_raw_parts(args_ptr, args_len) } };
+    let handles = if initial_handles_len == 0 { &[][..] } else { unsafe { core::slice::from_raw_parts(initial_handles_ptr, initial_handles_len) } };
+    match task::template_create(Handle(code_handle), args, handles) {
+        Ok(h) => { unsafe { *out_template_handle = h.raw(); } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_task_template_checkpoint(args_buf: *mut u8, args_buf_len: usize, out_args_len: *mut usize) -> i32 {
+    if (args_buf.is_null() && args_buf_len != 0) || out_args_len.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let buf = if args_buf_len == 0 { &mut [][..] } else { unsafe { core::slice::from_raw_parts_mut(args_buf, args_buf_len) } };
+    match task::template_checkpoint(buf) {
+        Ok(len) => { unsafe { *out_args_len = len; } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_task_spawn_from_template(template_handle: u64, args_ptr: *const u8, args_len: usize,
+                                                 initial_handles_ptr: *const Handle, initial_handles_len: usize,
+                                                 out_task_id: *mut u64) -> i32 {
+    if (args_ptr.is_null() && args_len != 0) || (initial_handles_ptr.is_null() && initial_handles_len != 0) || out_task_id.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let args = if args_len == 0 { &[][..] } else { unsafe { core::slice::from_raw_parts(args_ptr, args_len) } };
+    let handles = if initial_handles_len == 0 { &[][..] } else { unsafe { core::slice::from_raw_parts(initial_handles_ptr, initial_handles_len) } };
+    match task::spawn_from_template(Handle(template_handle), args, handles) {
+        Ok(id) => { unsafe { *out_task_id = id.raw(); } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_channel_create_pair(out_handle_a: *mut u64, out_handle_b: *mut u64) -> i32 {
+    if out_handle_a.is_null() || out_handle_b.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    match messaging::create_channel_pair() {
+        Ok((a, b)) => { unsafe { *out_handle_a = a.raw(); *out_handle_b = b.raw(); } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_task_open(task_id: u64, out_handle: *mut u64) -> i32 {
+    if out_handle.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    match task::open(TaskId(task_id)) {
+        Ok(h) => { unsafe { *out_handle = h.raw(); } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_task_wait_many(task_ids: *const TaskId, count: usize, flags: u32, timeout_ms: i64,
+                                       out_results: *mut task::TaskExitStatus, out_reaped: *mut usize) -> i32 {
+    let children = flags & task::WAIT_CHILDREN != 0;
+    if (task_ids.is_null() && !children && count != 0) || (out_results.is_null() && count != 0) || out_reaped.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let ids = if children || count == 0 { &[][..] } else { unsafe { core::slice::from_raw_parts(task_ids, count) } };
+    let results = if count == 0 { &mut [][..] } else { unsafe { core::slice::from_raw_parts_mut(out_results, count) } };
+    let timeout = if timeout_ms < 0 { None } else { Some(core::time::Duration::from_millis(timeout_ms as u64)) };
+    match task::wait_many(ids, flags, timeout, results) {
+        Ok(n) => { unsafe { *out_reaped = n; } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_timer_create(out_handle: *mut u64) -> i32 {
+    if out_handle.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    match timer::create() {
+        Ok(h) => { unsafe { *out_handle = h.raw(); } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_timer_set(handle: u64, initial_ns: u64, interval_ns: u64, flags: u32) -> i32 {
+    match timer::set(Handle(handle), initial_ns, interval_ns, flags) {
+        Ok(()) => 0,
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_task_sleep_ns(nanoseconds: u64) -> i32 {
+    match task::sleep(core::time::Duration::from_nanos(nanoseconds)) {
+        Ok(()) => 0,
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_poll_ns(entries: *mut poll::PollEntry, num_entries: usize, timeout_ns: i64) -> i64 {
+    if entries.is_null() && num_entries != 0 {
+        return map_sahne_error_to_kernel(SahneError::InvalidAddress);
+    }
+    let entries = if num_entries == 0 { &mut [][..] } else { unsafe { core::slice::from_raw_parts_mut(entries, num_entries) } };
+    let timeout = if timeout_ns < 0 { None } else { Some(core::time::Duration::from_nanos(timeout_ns as u64)) };
+    match poll::poll(entries, timeout) {
+        Ok(ready) => ready as i64,
+        Err(e) => map_sahne_error_to_kernel(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_poll(entries: *mut poll::PollEntry, num_entries: usize, timeout_ms: i64) -> i64 {
+    sahne_poll_ns(entries, num_entries, if timeout_ms < 0 { -1 } else { timeout_ms.saturating_mul(1_000_000) })
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_kernel_get_stats(out_stats: *mut kernel::KernelStats) -> i32 {
+    if out_stats.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    match kernel::get_stats() {
+        Ok(stats) => { unsafe { *out_stats = stats; } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_mem_pressure_open(min_level: u32, out_handle: *mut u64) -> i32 {
+    if out_handle.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    match memory::pressure_open(min_level) {
+        Ok(h) => { unsafe { *out_handle = h.raw(); } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_mem_notify_shared(handle: u64, value: u64) -> i32 {
+    match memory::notify_shared(Handle(handle), value) {
+        Ok(()) => 0,
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_mem_watch_shared(handle: u64, out_watch_handle: *mut u64) -> i32 {
+    if out_watch_handle.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    match memory::watch_shared(Handle(handle)) {
+        Ok(h) => { unsafe { *out_watch_handle = h.raw(); } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_resource_enumerate(dir_handle: u64, buffer_ptr: *mut u8, buffer_len: usize,
+                                           inout_cookie: *mut u64, out_count: *mut usize) -> i32 {
+    if buffer_ptr.is_null() || inout_cookie.is_null() || out_count.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let buffer = unsafe { core::slice::from_raw_parts_mut(buffer_ptr, buffer_len) };
+    match resource::enumerate(Handle(dir_handle), buffer, unsafe { &mut *inout_cookie }) {
+        Ok(count) => { unsafe { *out_count = count; } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_resource_copy_range(src_handle: u64, src_offset: u64, dst_handle: u64, dst_offset: u64,
+                                            len: u64, out_copied: *mut u64) -> i32 {
+    if out_copied.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let src_offset = if src_offset == resource::COPY_OFFSET_CURRENT { None } else { Some(src_offset) };
+    let dst_offset = if dst_offset == resource::COPY_OFFSET_CURRENT { None } else { Some(dst_offset) };
+    match resource::copy_range(Handle(src_handle), src_offset, Handle(dst_handle), dst_offset, len) {
+        Ok(copied) => { unsafe { *out_copied = copied; } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_resource_sync(handle: u64, flags: u32) -> i32 {
+    match resource::sync(Handle(handle), flags) {
+        Ok(()) => 0,
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_resource_flush(handle: u64) -> i32 {
+    match resource::flush(Handle(handle)) {
+        Ok(()) => 0,
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_resource_publish(name_ptr: *const u8, name_len: usize, out_channel_handle: *mut u64) -> i32 {
+    if name_ptr.is_null() || out_channel_handle.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let name = unsafe { core::slice::from_raw_parts(name_ptr, name_len) };
+    let name = match core::str::from_utf8(name) {
+        Ok(name) => name,
+        Err(_) => return map_sahne_error_to_c(SahneError::NamingError),
+    };
+    match resource::publish(name) {
+        Ok(h) => { unsafe { *out_channel_handle = h.raw(); } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_resource_advise(handle: u64, offset: u64, len: u64, advice: u32) -> i32 {
+    match resource::advise(Handle(handle), offset, len, advice) {
+        Ok(()) => 0,
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_resource_prefetch(handle: u64, offset: u64, len: u64) -> i32 {
+    match resource::prefetch(Handle(handle), offset, len) {
+        Ok(()) => 0,
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_mem_advise(addr: *mut u8, len: usize, advice: u32) -> i32 {
+    let addr = match core::ptr::NonNull::new(addr) {
+        Some(addr) => addr,
+        None => return map_sahne_error_to_c(SahneError::InvalidAddress),
+    };
+    match memory::advise(addr, len, advice) {
+        Ok(()) => 0,
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_crc32c(crc: u32, data: *const u8, len: usize) -> u32 {
+    if data.is_null() || len == 0 {
+        return crc;
+    }
+    checksum::crc32c(crc, unsafe { core::slice::from_raw_parts(data, len) })
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_crc32c_combine(crc1: u32, crc2: u32, len2: u64) -> u32 {
+    checksum::crc32c_combine(crc1, crc2, len2)
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_xxhash64(data: *const u8, len: usize, seed: u64) -> u64 {
+    let data = if data.is_null() || len == 0 { &[][..] } else { unsafe { core::slice::from_raw_parts(data, len) } };
+    checksum::xxhash64(data, seed)
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_checksum_kernels() -> u32 {
+    checksum::available_kernels()
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_checksum_active_kernel() -> u32 {
+    checksum::active_kernel()
+}
+
+#[no_mangle]
+pub extern "C" fn sahne_crc32c_with_kernel(kernel: u32, crc: u32, data: *const u8, len: usize, out_crc: *mut u32) -> i32 {
+    if (data.is_null() && len != 0) || out_crc.is_null() {
+        return map_sahne_error_to_c(SahneError::InvalidAddress);
+    }
+    let data = if len == 0 { &[][..] } else { unsafe { core::slice::from_raw_parts(data, len) } };
+    match checksum::crc32c_with(kernel, crc, data) {
+        Ok(value) => { unsafe { *out_crc = value; } 0 }
+        Err(e) => map_sahne_error_to_c(e),
+    }
+}
+
 // --- no_std için Gerekli Olabilecekler (önceki koddan) ---
 
 #[cfg(not(test))]
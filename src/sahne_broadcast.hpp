@@ -0,0 +1,308 @@
+#ifndef SAHNE_BROADCAST_HPP
+#define SAHNE_BROADCAST_HPP
+
+// Paylaşımlı bellek üzerinde tek yazıcılı, çok okuyuculu yayın (broadcast) kanalı
+// (sahne64.rs broadcast modülü ile aynı düzen ve protokol; bkz. sahne.h SahneBroadcastHeader_t).
+// Bir mesajı N aboneye göndermek N kez sahne_channel_send yerine halkaya tek bir yazmadır.
+// - Sender::send hiçbir zaman okuyucuları beklemez. Yalnızca park etmiş okuyucu varsa tek bir
+//   sahne_mem_notify_shared çağrısı yapar (abone sayısından bağımsız).
+// - Geride kalan Receiver SAHNE_ERROR_LAGGED alır; imleci en eski geçerli mesaja taşınır, missed() artar.
+// - Receiver::watch_handle() poll kümelerine SAHNE_POLL_READABLE ile eklenebilir.
+//
+// Paylaşımlı alanlara GCC/Clang __atomic yerleşikleriyle erişilir (C++17'de std::atomic_ref yok).
+
+#include "sahne.h"
+#include "sahne.hpp"
+
+#include <cstdint>
+#include <cstring> // std::memcpy
+
+namespace sahne {
+namespace broadcast {
+
+constexpr size_t kHeaderSize = sizeof(SahneBroadcastHeader_t);
+constexpr size_t kSlotHeaderSize = sizeof(SahneBroadcastSlot_t);
+
+/// En fazla `max_message` byte'lık mesajlar için yuva boyutu.
+constexpr size_t slot_size_for(size_t max_message) {
+    return (kSlotHeaderSize + max_message + SAHNE_BROADCAST_SLOT_ALIGN - 1) & ~size_t{SAHNE_BROADCAST_SLOT_ALIGN - 1};
+}
+
+namespace detail {
+
+/// Eşlenmiş halka üzerindeki ortak işlemler.
+struct Ring {
+    uint8_t* base = nullptr;
+    uint64_t mask = 0;
+    size_t slot_size = 0;
+
+    SahneBroadcastHeader_t* header() const { return reinterpret_cast<SahneBroadcastHeader_t*>(base); }
+    SahneBroadcastSlot_t* slot(uint64_t seq) const {
+        return reinterpret_cast<SahneBroadcastSlot_t*>(base + kHeaderSize + (seq & mask) * slot_size);
+    }
+    uint8_t* payload(SahneBroadcastSlot_t* slot) const { return reinterpret_cast<uint8_t*>(slot) + kSlotHeaderSize; }
+    size_t max_message() const { return slot_size - kSlotHeaderSize; }
+};
+
+} // namespace detail
+
+/// Yayın kanalının tek yazıcısı. Nesne yok edildiğinde kanal kapatılır.
+class Sender {
+public:
+    Sender() = default;
+    Sender(const Sender&) = delete;
+    Sender& operator=(const Sender&) = delete;
+    ~Sender() { close(); }
+
+    /// `slot_count` (2'nin kuvveti, >= 2) yuvalı, en fazla `max_message` byte'lık mesajlar taşıyan bir kanal
+    /// oluşturur. Aboneler handle()'ı (örn. sahne_channel_send_with_handles ile) alıp Receiver::attach çağırır.
+    sahne_error_t create(uint32_t slot_count, uint32_t max_message) {
+        close();
+        if (slot_count < 2 || (slot_count & (slot_count - 1)) != 0 || max_message == 0) {
+            return SAHNE_ERROR_INVALID_PARAMETER;
+        }
+        const size_t slot_size = slot_size_for(max_message);
+        sahne_error_t err = shm_.create(SAHNE_BROADCAST_REGION_SIZE(slot_count, slot_size));
+        if (err != SAHNE_SUCCESS) {
+            shm_.reset();
+            return err;
+        }
+        ring_.base = shm_.data();
+        ring_.mask = slot_count - 1;
+        ring_.slot_size = slot_size;
+        // Yeni paylaşımlı bellek sıfırlı gelir; yuvaların seq değeri 0 = "hiç yazılmadı"
+        SahneBroadcastHeader_t* header = ring_.header();
+        header->version = SAHNE_BROADCAST_VERSION;
+        header->slot_count = slot_count;
+        header->slot_size = static_cast<uint32_t>(slot_size);
+        __atomic_store_n(&header->magic, SAHNE_BROADCAST_MAGIC, __ATOMIC_RELEASE); // En son: abonelere "hazır"
+        return SAHNE_SUCCESS;
+    }
+
+    /// Abonelere dağıtılacak paylaşımlı bellek handle'ı (sahiplik Sender'da kalır).
+    sahne_handle_t handle() const { return shm_.handle(); }
+    size_t max_message() const { return ring_.max_message(); }
+
+    /// Mesajı yayınlar; `out_seq` (isteğe bağlı) mesajın sıra numarasını alır.
+    sahne_error_t send(const uint8_t* data, size_t len, uint64_t* out_seq = nullptr) {
+        if (ring_.base == nullptr) {
+            return SAHNE_ERROR_INVALID_OPERATION;
+        }
+        if (len > ring_.max_message()) {
+            return SAHNE_ERROR_INVALID_PARAMETER;
+        }
+        SahneBroadcastHeader_t* header = ring_.header();
+        const uint64_t n = __atomic_load_n(&header->write_seq, __ATOMIC_RELAXED); // Yalnızca bu yazıcı değiştirir
+        SahneBroadcastSlot_t* slot = ring_.slot(n);
+        __atomic_store_n(&slot->seq, 2 * n + 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE); // Veri yazmaları "yazılıyor" işaretinden önce görünmesin
+        std::memcpy(ring_.payload(slot), data, len);
+        __atomic_store_n(&slot->len, static_cast<uint32_t>(len), __ATOMIC_RELAXED);
+        __atomic_store_n(&slot->seq, 2 * n + 2, __ATOMIC_RELEASE);
+        __atomic_store_n(&header->write_seq, n + 1, __ATOMIC_RELEASE);
+        if (out_seq != nullptr) {
+            *out_seq = n;
+        }
+        return wake(n + 1);
+    }
+
+    /// Kanalı kapatır: okuyucular kalan mesajları okuduktan sonra SAHNE_ERROR_DISCONNECTED alır.
+    sahne_error_t close() {
+        if (ring_.base == nullptr) {
+            return SAHNE_SUCCESS;
+        }
+        SahneBroadcastHeader_t* header = ring_.header();
+        __atomic_store_n(&header->closed, 1u, __ATOMIC_RELEASE);
+        sahne_error_t err = wake(__atomic_load_n(&header->write_seq, __ATOMIC_RELAXED));
+        ring_ = detail::Ring{};
+        shm_.reset();
+        return err;
+    }
+
+private:
+    sahne_error_t wake(uint64_t value) {
+        // waiters okuması yayından sonra sıralanmalı (okuyucu tarafındaki seq_cst artırma ile eşleşir)
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&ring_.header()->waiters, __ATOMIC_RELAXED) != 0) {
+            return sahne_mem_notify_shared(shm_.handle(), value);
+        }
+        return SAHNE_SUCCESS;
+    }
+
+    memory::SharedBuffer shm_;
+    detail::Ring ring_;
+};
+
+/// Yayın kanalının bir abonesi. Her okuyucu kendi imlecini tutar; tek iş parçacığından kullanılır.
+class Receiver {
+public:
+    Receiver() = default;
+    Receiver(const Receiver&) = delete;
+    Receiver& operator=(const Receiver&) = delete;
+    ~Receiver() { detach(); }
+
+    /// Kanala abone olur. `shm` yayın kanalının paylaşımlı bellek handle'ıdır; sahipliği çağıranda kalır
+    /// (aynı handle ile birden çok Receiver açılabilir). Okuyucu şu andan sonra yayınlanan mesajları alır.
+    sahne_error_t attach(sahne_handle_t shm) {
+        detach();
+        sahne_error_t err = shm_.map_existing(shm, kHeaderSize);
+        bool valid = false;
+        uint32_t slot_count = 0;
+        size_t slot_size = 0;
+        if (err == SAHNE_SUCCESS) {
+            const SahneBroadcastHeader_t* probe = reinterpret_cast<const SahneBroadcastHeader_t*>(shm_.data());
+            valid = __atomic_load_n(&probe->magic, __ATOMIC_ACQUIRE) == SAHNE_BROADCAST_MAGIC &&
+                    probe->version == SAHNE_BROADCAST_VERSION;
+            slot_count = probe->slot_count;
+            slot_size = probe->slot_size;
+        }
+        detach(); // Deneme eşlemesini kaldır
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        if (!valid || slot_count < 2 || (slot_count & (slot_count - 1)) != 0 ||
+            slot_size <= kSlotHeaderSize || slot_size % SAHNE_BROADCAST_SLOT_ALIGN != 0) {
+            return SAHNE_ERROR_INVALID_OPERATION;
+        }
+        err = shm_.map_existing(shm, SAHNE_BROADCAST_REGION_SIZE(slot_count, slot_size));
+        if (err == SAHNE_SUCCESS) {
+            err = sahne_mem_watch_shared(shm, &watch_);
+        }
+        if (err != SAHNE_SUCCESS) {
+            detach();
+            return err;
+        }
+        ring_.base = shm_.data();
+        ring_.mask = slot_count - 1;
+        ring_.slot_size = slot_size;
+        cursor_ = __atomic_load_n(&ring_.header()->write_seq, __ATOMIC_ACQUIRE);
+        missed_ = 0;
+        return SAHNE_SUCCESS;
+    }
+
+    /// Poll kümelerine eklenebilecek izleme handle'ı. Yazıcı yalnızca park etmiş okuyucu varken bildirim
+    /// yaptığından, kendi poll döngüsünü kullanan okuyucu bunun yerine receive() kullanmalıdır.
+    sahne_handle_t watch_handle() const { return watch_; }
+    size_t max_message() const { return ring_.max_message(); }
+
+    /// Geride kalınarak kaçırılan toplam mesaj sayısı.
+    uint64_t missed() const { return missed_; }
+
+    /// Henüz okunmamış mesaj sayısı.
+    uint64_t pending() const {
+        if (ring_.base == nullptr) {
+            return 0;
+        }
+        uint64_t head = __atomic_load_n(&ring_.header()->write_seq, __ATOMIC_ACQUIRE);
+        return head > cursor_ ? head - cursor_ : 0;
+    }
+
+    /// Bekleyen bir mesajı `buffer`'a kopyalar.
+    /// SAHNE_ERROR_WOULD_BLOCK: yeni mesaj yok. SAHNE_ERROR_LAGGED: mesajların üzerine yazıldı, imleç en eski
+    /// geçerli mesaja taşındı. SAHNE_ERROR_DISCONNECTED: yazıcı kapandı ve tüm mesajlar okundu.
+    /// SAHNE_ERROR_INVALID_PARAMETER: tampon mesaj için küçük (mesaj tüketilmez).
+    sahne_error_t try_receive(uint8_t* buffer, size_t buffer_len, size_t* out_len) {
+        if (ring_.base == nullptr) {
+            return SAHNE_ERROR_INVALID_OPERATION;
+        }
+        SahneBroadcastHeader_t* header = ring_.header();
+        const bool closed = __atomic_load_n(&header->closed, __ATOMIC_ACQUIRE) != 0;
+        const uint64_t head = __atomic_load_n(&header->write_seq, __ATOMIC_ACQUIRE);
+        if (cursor_ >= head) {
+            return closed ? SAHNE_ERROR_DISCONNECTED : SAHNE_ERROR_WOULD_BLOCK;
+        }
+        if (head - cursor_ > ring_.mask) {
+            return skip_lagged();
+        }
+        const uint64_t expected = 2 * cursor_ + 2;
+        SahneBroadcastSlot_t* slot = ring_.slot(cursor_);
+        if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != expected) {
+            return skip_lagged(); // Yazıcı bu yuvayı yeniden kullanmaya başladı
+        }
+        const size_t len = __atomic_load_n(&slot->len, __ATOMIC_RELAXED);
+        if (len > ring_.max_message()) {
+            return skip_lagged(); // Yarım yazılmış yuva
+        }
+        if (len > buffer_len) {
+            return SAHNE_ERROR_INVALID_PARAMETER;
+        }
+        std::memcpy(buffer, ring_.payload(slot), len);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) != expected) {
+            return skip_lagged(); // Kopyalama sırasında üzerine yazıldı
+        }
+        ++cursor_;
+        *out_len = len;
+        return SAHNE_SUCCESS;
+    }
+
+    /// try_receive gibi, ancak mesaj yoksa izleme handle'ı üzerinde bekler. `timeout_ns` her bekleme için
+    /// uygulanır (-1 sonsuz); süre dolarsa SAHNE_ERROR_TIMED_OUT döner.
+    sahne_error_t receive(uint8_t* buffer, size_t buffer_len, size_t* out_len, int64_t timeout_ns = -1) {
+        for (;;) {
+            sahne_error_t err = try_receive(buffer, buffer_len, out_len);
+            if (err != SAHNE_ERROR_WOULD_BLOCK) {
+                return err;
+            }
+            uint32_t* waiters = &ring_.header()->waiters;
+            __atomic_fetch_add(waiters, 1u, __ATOMIC_SEQ_CST);
+            // Artırmadan sonra tekrar kontrol et: yazıcı bizi görmeden yayın yapmış olabilir
+            err = try_receive(buffer, buffer_len, out_len);
+            if (err != SAHNE_ERROR_WOULD_BLOCK) {
+                __atomic_fetch_sub(waiters, 1u, __ATOMIC_SEQ_CST);
+                return err;
+            }
+            PollEntry_t entry{};
+            entry.handle = watch_;
+            entry.events_in = SAHNE_POLL_READABLE;
+            entry.events_out = SAHNE_POLL_NONE;
+            int64_t ready = sahne_poll_ns(&entry, 1, timeout_ns);
+            __atomic_fetch_sub(waiters, 1u, __ATOMIC_SEQ_CST);
+            if (ready < 0) {
+                return map_kernel_error(ready);
+            }
+            if (ready == 0) {
+                return SAHNE_ERROR_TIMED_OUT;
+            }
+            uint64_t value = 0;
+            size_t bytes_read = 0;
+            err = sahne_resource_read(watch_, reinterpret_cast<uint8_t*>(&value), sizeof(value), &bytes_read);
+            if (err != SAHNE_SUCCESS) {
+                return err;
+            }
+        }
+    }
+
+    /// Aboneliği bırakır (eşleme ve izleme handle'ı; paylaşımlı bellek handle'ı çağıranda kalır).
+    void detach() {
+        if (watch_ != 0) {
+            sahne_resource_release(watch_);
+        }
+        watch_ = 0;
+        ring_ = detail::Ring{};
+        shm_.release_handle();
+        shm_.reset();
+    }
+
+private:
+    sahne_error_t skip_lagged() {
+        // Yazılmakta olan yuva (head) ile aynı yuvaya düşmemek için head - slot_count + 1'den devam edilir
+        const uint64_t head = __atomic_load_n(&ring_.header()->write_seq, __ATOMIC_ACQUIRE);
+        const uint64_t oldest = head > ring_.mask ? head - ring_.mask : 0;
+        const uint64_t next = oldest > cursor_ ? oldest : cursor_ + 1;
+        missed_ += next - cursor_;
+        cursor_ = next;
+        return SAHNE_ERROR_LAGGED;
+    }
+
+    memory::SharedBuffer shm_;
+    detail::Ring ring_;
+    sahne_handle_t watch_ = 0;
+    uint64_t cursor_ = 0;
+    uint64_t missed_ = 0;
+};
+
+} // namespace broadcast
+} // namespace sahne
+
+#endif // SAHNE_BROADCAST_HPP
@@ -0,0 +1,215 @@
+#ifndef SAHNE_CHECKSUM_HPP
+#define SAHNE_CHECKSUM_HPP
+
+// Kaynak akışları için sağlama toplamı (checksum) aşaması (sahne64.rs checksum modülünün C++ karşılığı).
+// - ChecksumWriter: veriyi sabit boyutlu bloklar halinde kaynağa yazar, her bloğun CRC32C veya xxHash64
+//   değerini isteğe bağlı olarak bir yan dosyaya (sidecar, ChecksumSidecarHeader_t formatı) ekler.
+// - ChecksumReader: yan dosyayı kullanarak blokları okur ve doğrular; uyuşmazlıkta
+//   SAHNE_ERROR_CHECKSUM_MISMATCH döner.
+// Hesaplamalar sahne_crc32c / sahne_xxhash64 üzerinden yapılır; CRC32C çekirdeği çalışma zamanında seçilir.
+
+#include "sahne.h"
+
+#include <algorithm> // std::min
+#include <cstdint>
+#include <cstring>   // std::memcpy
+#include <vector>
+
+namespace sahne {
+namespace checksum {
+
+inline uint32_t crc32c(uint32_t crc, const uint8_t* data, size_t len) { return sahne_crc32c(crc, data, len); }
+inline uint64_t xxhash64(const uint8_t* data, size_t len, uint64_t seed = 0) { return sahne_xxhash64(data, len, seed); }
+
+/// Bir bloğun `algorithm` (SAHNE_CHECKSUM_*) ile sağlama toplamı.
+inline sahne_error_t block_checksum(uint16_t algorithm, const uint8_t* data, size_t len, uint64_t* out_sum) {
+    switch (algorithm) {
+        case SAHNE_CHECKSUM_CRC32C:   *out_sum = crc32c(0, data, len); return SAHNE_SUCCESS;
+        case SAHNE_CHECKSUM_XXHASH64: *out_sum = xxhash64(data, len); return SAHNE_SUCCESS;
+        default:                      return SAHNE_ERROR_INVALID_PARAMETER;
+    }
+}
+
+namespace detail {
+
+inline sahne_error_t write_all(sahne_handle_t handle, const uint8_t* data, size_t len) {
+    while (len != 0) {
+        size_t n = 0;
+        sahne_error_t err = sahne_resource_write(handle, data, len, &n);
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        if (n == 0) {
+            return SAHNE_ERROR_INVALID_OPERATION; // Hedef ilerlemiyor
+        }
+        data += n;
+        len -= n;
+    }
+    return SAHNE_SUCCESS;
+}
+
+inline sahne_error_t read_full(sahne_handle_t handle, uint8_t* data, size_t len, size_t* out_read) {
+    *out_read = 0;
+    while (*out_read < len) {
+        size_t n = 0;
+        sahne_error_t err = sahne_resource_read(handle, data + *out_read, len - *out_read, &n);
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        if (n == 0) {
+            break; // Kaynağın sonu
+        }
+        *out_read += n;
+    }
+    return SAHNE_SUCCESS;
+}
+
+} // namespace detail
+
+class ChecksumWriter {
+public:
+    /// `data_handle` verinin, `sidecar_handle` (0 = yok) blok sağlama toplamlarının yazılacağı kaynaktır;
+    /// sahiplikleri çağıranda kalır. Yazmadan önce open() çağrılmalıdır.
+    ChecksumWriter(sahne_handle_t data_handle, sahne_handle_t sidecar_handle, uint16_t algorithm, uint32_t block_size)
+        : data_(data_handle), sidecar_(sidecar_handle), algorithm_(algorithm), block_(block_size) {}
+
+    /// Parametreleri doğrular ve (varsa) yan dosya başlığını yazar.
+    sahne_error_t open() {
+        if (block_.empty() || (algorithm_ != SAHNE_CHECKSUM_CRC32C && algorithm_ != SAHNE_CHECKSUM_XXHASH64)) {
+            return SAHNE_ERROR_INVALID_PARAMETER;
+        }
+        if (sidecar_ == 0) {
+            return SAHNE_SUCCESS;
+        }
+        ChecksumSidecarHeader_t header{};
+        header.magic = SAHNE_CHECKSUM_SIDECAR_MAGIC;
+        header.version = SAHNE_CHECKSUM_SIDECAR_VERSION;
+        header.algorithm = algorithm_;
+        header.block_size = static_cast<uint32_t>(block_.size());
+        return detail::write_all(sidecar_, reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+    }
+
+    /// Veriyi bloklara bölerek yazar. open() başarısız olduysa (block_size 0) INVALID_PARAMETER döner.
+    sahne_error_t write(const uint8_t* data, size_t len) {
+        if (block_.empty()) {
+            return SAHNE_ERROR_INVALID_PARAMETER;
+        }
+        while (len != 0) {
+            size_t n = std::min(len, block_.size() - fill_);
+            std::memcpy(block_.data() + fill_, data, n);
+            fill_ += n;
+            data += n;
+            len -= n;
+            if (fill_ == block_.size()) {
+                sahne_error_t err = flush_block();
+                if (err != SAHNE_SUCCESS) {
+                    return err;
+                }
+            }
+        }
+        return SAHNE_SUCCESS;
+    }
+
+    /// Kalan kısmi bloğu yazar.
+    sahne_error_t finish() { return fill_ == 0 ? SAHNE_SUCCESS : flush_block(); }
+
+    uint64_t blocks_written() const { return blocks_; }
+
+private:
+    sahne_error_t flush_block() {
+        uint64_t sum = 0;
+        sahne_error_t err = block_checksum(algorithm_, block_.data(), fill_, &sum);
+        if (err == SAHNE_SUCCESS) {
+            err = detail::write_all(data_, block_.data(), fill_);
+        }
+        if (err == SAHNE_SUCCESS && sidecar_ != 0) {
+            err = detail::write_all(sidecar_, reinterpret_cast<const uint8_t*>(&sum), sizeof(sum)); // Little-endian varsayılır
+        }
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        fill_ = 0;
+        ++blocks_;
+        return SAHNE_SUCCESS;
+    }
+
+    sahne_handle_t data_;
+    sahne_handle_t sidecar_;
+    uint16_t algorithm_;
+    std::vector<uint8_t> block_;
+    size_t fill_ = 0;
+    uint64_t blocks_ = 0;
+};
+
+class ChecksumReader {
+public:
+    ChecksumReader(sahne_handle_t data_handle, sahne_handle_t sidecar_handle)
+        : data_(data_handle), sidecar_(sidecar_handle) {}
+
+    /// Yan dosya başlığını okur ve doğrular.
+    sahne_error_t open() {
+        uint64_t pos = 0;
+        sahne_error_t err = sahne_resource_seek(sidecar_, SAHNE_SEEK_SET, 0, &pos);
+        size_t n = 0;
+        if (err == SAHNE_SUCCESS) {
+            err = detail::read_full(sidecar_, reinterpret_cast<uint8_t*>(&header_), sizeof(header_), &n);
+        }
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        if (n != sizeof(header_) || header_.magic != SAHNE_CHECKSUM_SIDECAR_MAGIC ||
+            header_.version != SAHNE_CHECKSUM_SIDECAR_VERSION || header_.block_size == 0) {
+            return SAHNE_ERROR_INVALID_OPERATION;
+        }
+        return SAHNE_SUCCESS;
+    }
+
+    const ChecksumSidecarHeader_t& header() const { return header_; }
+
+    /// `index` numaralı bloğu `out`'a okur ve doğrular (son blok kısa olabilir).
+    /// Son bloğun ötesinde (veri ve sağlama toplamı yok) SAHNE_ERROR_RESOURCE_NOT_FOUND döner;
+    /// SAHNE_ERROR_CHECKSUM_MISMATCH yalnızca bozulmayı bildirir.
+    sahne_error_t read_block(uint64_t index, std::vector<uint8_t>& out) {
+        out.resize(header_.block_size);
+        uint64_t pos = 0;
+        size_t n = 0;
+        sahne_error_t err = sahne_resource_seek(data_, SAHNE_SEEK_SET, static_cast<int64_t>(index * header_.block_size), &pos);
+        if (err == SAHNE_SUCCESS) {
+            err = detail::read_full(data_, out.data(), out.size(), &n);
+        }
+        uint64_t stored = 0;
+        size_t stored_len = 0;
+        if (err == SAHNE_SUCCESS) {
+            err = sahne_resource_seek(sidecar_, SAHNE_SEEK_SET, static_cast<int64_t>(sizeof(header_) + index * sizeof(stored)), &pos);
+        }
+        if (err == SAHNE_SUCCESS) {
+            err = detail::read_full(sidecar_, reinterpret_cast<uint8_t*>(&stored), sizeof(stored), &stored_len);
+        }
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        out.resize(n);
+        if (n == 0 && stored_len == 0) {
+            return SAHNE_ERROR_RESOURCE_NOT_FOUND; // Verinin sonu
+        }
+        uint64_t sum = 0;
+        err = block_checksum(header_.algorithm, out.data(), n, &sum);
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        if (stored_len != sizeof(stored) || sum != stored) {
+            return SAHNE_ERROR_CHECKSUM_MISMATCH;
+        }
+        return SAHNE_SUCCESS;
+    }
+
+private:
+    sahne_handle_t data_;
+    sahne_handle_t sidecar_;
+    ChecksumSidecarHeader_t header_{};
+};
+
+} // namespace checksum
+} // namespace sahne
+
+#endif // SAHNE_CHECKSUM_HPP
@@ -0,0 +1,110 @@
+#ifndef SAHNE_GROUP_COMMIT_HPP
+#define SAHNE_GROUP_COMMIT_HPP
+
+// Kaynak yazmaları için grup commit (group commit) yardımcısı.
+// Birçok iş parçacığı kayıt ekler (append); o anda sync yapan kimse yoksa ekleyenlerden biri lider olur,
+// biriken tüm kayıtları tek bir yazma ve tek bir sahne_resource_sync ile kalıcı hale getirir ve
+// o gruptaki tüm bekleyenleri uyandırır. Lider sync yaparken gelen kayıtlar bir sonraki gruba birikir;
+// böylece eşzamanlılık arttıkça sync başına commit sayısı da artar.
+//
+// Bir sync hatası kalıcıdır: kalıcılığı bilinmeyen yazmalar yeniden denenmez, sonraki tüm append
+// çağrıları aynı hatayı döner (bkz. sahne_resource_sync).
+
+#include "sahne.h"
+
+#include <condition_variable> // std::condition_variable
+#include <cstdint>
+#include <mutex>              // std::mutex
+#include <vector>
+
+namespace sahne {
+namespace resource {
+
+class GroupCommitLog {
+public:
+    /// `handle` yazma izinli, konumu kaydın ekleneceği yerde olan (örn. dosya sonu) bir kaynaktır;
+    /// sahipliği çağıranda kalır. `sync_flags` SAHNE_SYNC_* bayraklarıdır.
+    explicit GroupCommitLog(sahne_handle_t handle, uint32_t sync_flags = SAHNE_SYNC_DATA)
+        : handle_(handle), sync_flags_(sync_flags) {}
+
+    GroupCommitLog(const GroupCommitLog&) = delete;
+    GroupCommitLog& operator=(const GroupCommitLog&) = delete;
+
+    /// Kaydı ekler ve kalıcı olana kadar bekler. Kayıtlar gruplar içinde ekleme sırasıyla yazılır.
+    sahne_error_t append(const uint8_t* data, size_t len) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (error_ != SAHNE_SUCCESS) {
+            return error_;
+        }
+        pending_.insert(pending_.end(), data, data + len);
+        const uint64_t my_batch = open_batch_;
+        while (durable_batch_ < my_batch && error_ == SAHNE_SUCCESS) {
+            if (syncing_) {
+                cv_.wait(lock);
+                continue;
+            }
+            // Lider ol: o ana kadar biriken her şeyi tek grupta commit et
+            syncing_ = true;
+            const uint64_t batch = open_batch_++;
+            batch_.swap(pending_);
+            pending_.clear();
+            lock.unlock();
+
+            sahne_error_t err = write_all(batch_.data(), batch_.size());
+            if (err == SAHNE_SUCCESS) {
+                err = sahne_resource_sync(handle_, sync_flags_);
+            }
+
+            lock.lock();
+            syncing_ = false;
+            ++syncs_;
+            if (err != SAHNE_SUCCESS) {
+                error_ = err;
+            } else {
+                durable_batch_ = batch;
+            }
+            cv_.notify_all();
+        }
+        return durable_batch_ >= my_batch ? SAHNE_SUCCESS : error_;
+    }
+
+    /// Şimdiye kadar yapılan sync sayısı (commit/sync oranını ölçmek için).
+    uint64_t sync_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return syncs_;
+    }
+
+private:
+    sahne_error_t write_all(const uint8_t* data, size_t len) {
+        size_t written = 0;
+        while (written < len) {
+            size_t n = 0;
+            sahne_error_t err = sahne_resource_write(handle_, data + written, len - written, &n);
+            if (err != SAHNE_SUCCESS) {
+                return err;
+            }
+            if (n == 0) {
+                return SAHNE_ERROR_INVALID_OPERATION; // Hedef ilerlemiyor
+            }
+            written += n;
+        }
+        return SAHNE_SUCCESS;
+    }
+
+    sahne_handle_t handle_;
+    uint32_t sync_flags_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<uint8_t> pending_; // Açık gruptaki kayıtlar
+    std::vector<uint8_t> batch_;   // Liderin yazmakta olduğu grup (yalnızca syncing_ iken kullanılır)
+    uint64_t open_batch_ = 1;      // Yeni kayıtların gireceği grup
+    uint64_t durable_batch_ = 0;   // Kalıcı olduğu bilinen son grup
+    uint64_t syncs_ = 0;
+    bool syncing_ = false;
+    sahne_error_t error_ = SAHNE_SUCCESS;
+};
+
+} // namespace resource
+} // namespace sahne
+
+#endif // SAHNE_GROUP_COMMIT_HPP
@@ -0,0 +1,398 @@
+#ifndef SAHNE_METRICS_HPP
+#define SAHNE_METRICS_HPP
+
+// İş parçacığı başına parçalanmış (sharded) metrik kütüphanesi ve sahne://metrics/<görev> dışa aktarıcısı.
+// - Counter / Histogram: her iş parçacığı kendi önbellek satırındaki hücreyi artırır; toplama yalnızca
+//   okumada yapılır. Böylece sıcak yolda çekirdekler arasında önbellek satırı gidip gelmez.
+//   İş parçacıklarına hücreler ilk kullanımda sırayla atanır (kShardCount'tan fazla iş parçacığı hücre paylaşır).
+// - Gauge: "son değer" anlamı taşıdığından tek bir atomik değerdir.
+// - Registry: metrikleri adla tutar; ikili (sahne.h SahneMetricsHeader_t) ve metin formatında anlık görüntü üretir.
+// - Exporter: sahne_resource_publish ile "sahne://metrics/<görev id>" adını yayınlar; başka bir görev
+//   sahne_resource_acquire + tek bir sahne_resource_read ile ikili görüntüyü, "<ad>/text" ile metni okur.
+
+#include "sahne.h"
+#include "sahne.hpp"
+#include "sahne_rpc.hpp"
+
+#include <algorithm> // std::lower_bound, std::sort, std::min
+#include <atomic>    // std::atomic
+#include <cstddef>   // offsetof
+#include <cstdint>
+#include <cstring>   // std::memcpy
+#include <memory>    // std::unique_ptr
+#include <mutex>     // std::mutex
+#include <string>    // std::string
+#include <thread>    // std::thread
+#include <vector>
+
+namespace sahne {
+namespace metrics {
+
+constexpr size_t kShardCount = 64; // 2'nin kuvveti
+constexpr size_t kCacheLine = 64;
+
+namespace detail {
+
+/// Çağıran iş parçacığının hücre indeksi (ilk kullanımda sırayla atanır).
+inline size_t shard_index() {
+    static std::atomic<size_t> next{0};
+    thread_local size_t index = next.fetch_add(1, std::memory_order_relaxed) & (kShardCount - 1);
+    return index;
+}
+
+/// Kendi önbellek satırında duran sayaç hücreleri.
+struct alignas(kCacheLine) Line {
+    static constexpr size_t kCells = kCacheLine / sizeof(uint64_t);
+    std::atomic<uint64_t> cells[kCells]{};
+};
+
+inline void put(std::vector<uint8_t>& out, const void* data, size_t len) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    out.insert(out.end(), p, p + len);
+}
+
+inline void put_u64(std::vector<uint8_t>& out, uint64_t value) { put(out, &value, sizeof(value)); }
+
+} // namespace detail
+
+/// Yalnızca artan sayaç.
+class Counter {
+public:
+    void add(uint64_t n) { lines_[detail::shard_index()].cells[0].fetch_add(n, std::memory_order_relaxed); }
+    void inc() { add(1); }
+
+    /// Tüm hücrelerin toplamı (okuma sırasında yapılan artışlar kısmen görülebilir).
+    uint64_t value() const {
+        uint64_t total = 0;
+        for (const auto& line : lines_) {
+            total += line.cells[0].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    detail::Line lines_[kShardCount];
+};
+
+/// Anlık değer (örn. kuyruk uzunluğu, açık bağlantı sayısı).
+class Gauge {
+public:
+    void set(int64_t value) { value_.store(value, std::memory_order_relaxed); }
+    void add(int64_t delta) { value_.fetch_add(delta, std::memory_order_relaxed); }
+    int64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    alignas(kCacheLine) std::atomic<int64_t> value_{0};
+};
+
+/// Sabit kova sınırlı histogram. `bounds` artan üst sınırlardır (dahil); son kova (UINT64_MAX) otomatik eklenir.
+class Histogram {
+public:
+    explicit Histogram(std::vector<uint64_t> bounds) : bounds_(std::move(bounds)) {
+        std::sort(bounds_.begin(), bounds_.end());
+        bounds_.erase(std::unique(bounds_.begin(), bounds_.end()), bounds_.end());
+        if (bounds_.empty() || bounds_.back() != UINT64_MAX) {
+            bounds_.push_back(UINT64_MAX);
+        }
+        // Hücre düzeni: [sum][kova 0..n-1], iş parçacığı başına ayrı satır(lar)
+        lines_per_shard_ = (bounds_.size() + 1 + detail::Line::kCells - 1) / detail::Line::kCells;
+        lines_ = std::vector<detail::Line>(kShardCount * lines_per_shard_);
+    }
+
+    void observe(uint64_t value) {
+        size_t bucket = static_cast<size_t>(std::lower_bound(bounds_.begin(), bounds_.end(), value) - bounds_.begin());
+        size_t shard = detail::shard_index();
+        cell(shard, 0).fetch_add(value, std::memory_order_relaxed);
+        cell(shard, bucket + 1).fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const std::vector<uint64_t>& bounds() const { return bounds_; }
+
+    /// Kova sayılarını (kümülatif olmayan) ve toplamı okur; dönüş değeri gözlem sayısıdır.
+    uint64_t snapshot(std::vector<uint64_t>& counts, uint64_t* out_sum) const {
+        counts.assign(bounds_.size(), 0);
+        uint64_t sum = 0;
+        uint64_t count = 0;
+        for (size_t shard = 0; shard < kShardCount; ++shard) {
+            sum += cell(shard, 0).load(std::memory_order_relaxed);
+            for (size_t b = 0; b < bounds_.size(); ++b) {
+                uint64_t n = cell(shard, b + 1).load(std::memory_order_relaxed);
+                counts[b] += n;
+                count += n;
+            }
+        }
+        *out_sum = sum;
+        return count;
+    }
+
+private:
+    std::atomic<uint64_t>& cell(size_t shard, size_t index) const {
+        return lines_[shard * lines_per_shard_ + index / detail::Line::kCells].cells[index % detail::Line::kCells];
+    }
+
+    std::vector<uint64_t> bounds_;
+    size_t lines_per_shard_ = 0;
+    mutable std::vector<detail::Line> lines_;
+};
+
+/// Adlandırılmış metrik kümesi. Metrik nesneleri Registry yaşadıkça sabit adreslidir;
+/// sıcak yolda her seferinde aramak yerine dönen işaretçi saklanmalıdır.
+class Registry {
+public:
+    /// Adlı sayacı döner (yoksa oluşturur). Ad başka türde bir metriğe aitse veya geçersizse nullptr döner.
+    Counter* counter(const std::string& name) { return find_or_add<Counter>(name, SAHNE_METRIC_COUNTER, {}); }
+    Gauge* gauge(const std::string& name) { return find_or_add<Gauge>(name, SAHNE_METRIC_GAUGE, {}); }
+    /// Histogram zaten varsa `bounds` yok sayılır.
+    Histogram* histogram(const std::string& name, std::vector<uint64_t> bounds) {
+        return find_or_add<Histogram>(name, SAHNE_METRIC_HISTOGRAM, std::move(bounds));
+    }
+
+    /// İkili anlık görüntü (sahne.h SahneMetricsHeader_t formatı).
+    void encode_binary(std::vector<uint8_t>& out, uint64_t timestamp_ns) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        out.clear();
+        SahneMetricsHeader_t header{};
+        header.magic = SAHNE_METRICS_MAGIC;
+        header.version = SAHNE_METRICS_VERSION;
+        header.metric_count = static_cast<uint32_t>(entries_.size());
+        header.timestamp_ns = timestamp_ns;
+        detail::put(out, &header, sizeof(header));
+        std::vector<uint64_t> counts;
+        for (const auto& e : entries_) {
+            SahneMetricRecord_t record{};
+            record.kind = e.kind;
+            record.name_len = static_cast<uint16_t>(e.name.size());
+            record.bucket_count = e.histogram ? static_cast<uint32_t>(e.histogram->bounds().size()) : 0;
+            detail::put(out, &record, sizeof(record));
+            detail::put(out, e.name.data(), e.name.size());
+            out.resize((out.size() + 7) & ~size_t{7}, 0); // İsim dolgusu
+            if (e.counter) {
+                detail::put_u64(out, e.counter->value());
+            } else if (e.gauge) {
+                int64_t value = e.gauge->value();
+                detail::put(out, &value, sizeof(value));
+            } else {
+                uint64_t sum = 0;
+                detail::put_u64(out, e.histogram->snapshot(counts, &sum));
+                detail::put_u64(out, sum);
+                for (size_t b = 0; b < counts.size(); ++b) {
+                    detail::put_u64(out, e.histogram->bounds()[b]);
+                    detail::put_u64(out, counts[b]);
+                }
+            }
+        }
+        uint32_t total_len = static_cast<uint32_t>(out.size());
+        std::memcpy(out.data() + offsetof(SahneMetricsHeader_t, total_len), &total_len, sizeof(total_len));
+    }
+
+    /// Metin anlık görüntüsü: satır başına "ad değer"; histogramlar için kümülatif
+    /// "ad_bucket{le="sınır"}", "ad_sum" ve "ad_count" satırları.
+    void encode_text(std::string& out) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        out.clear();
+        std::vector<uint64_t> counts;
+        for (const auto& e : entries_) {
+            if (e.counter) {
+                out += "# TYPE " + e.name + " counter\n" + e.name + " " + std::to_string(e.counter->value()) + "\n";
+            } else if (e.gauge) {
+                out += "# TYPE " + e.name + " gauge\n" + e.name + " " + std::to_string(e.gauge->value()) + "\n";
+            } else {
+                uint64_t sum = 0;
+                uint64_t count = e.histogram->snapshot(counts, &sum);
+                out += "# TYPE " + e.name + " histogram\n";
+                uint64_t cumulative = 0;
+                for (size_t b = 0; b < counts.size(); ++b) {
+                    cumulative += counts[b];
+                    uint64_t bound = e.histogram->bounds()[b];
+                    out += e.name + "_bucket{le=\"" + (bound == UINT64_MAX ? std::string("+Inf") : std::to_string(bound)) +
+                           "\"} " + std::to_string(cumulative) + "\n";
+                }
+                out += e.name + "_sum " + std::to_string(sum) + "\n";
+                out += e.name + "_count " + std::to_string(count) + "\n";
+            }
+        }
+    }
+
+private:
+    struct Entry {
+        std::string name;
+        uint16_t kind;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+
+        void* get() const {
+            return counter ? static_cast<void*>(counter.get())
+                 : gauge   ? static_cast<void*>(gauge.get())
+                           : static_cast<void*>(histogram.get());
+        }
+    };
+
+    template <typename T>
+    T* find_or_add(const std::string& name, uint16_t kind, std::vector<uint64_t> bounds) {
+        if (name.empty() || name.size() > UINT16_MAX) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& e : entries_) {
+            if (e.name == name) {
+                return e.kind == kind ? static_cast<T*>(e.get()) : nullptr;
+            }
+        }
+        Entry e{name, kind, nullptr, nullptr, nullptr};
+        if (kind == SAHNE_METRIC_COUNTER) {
+            e.counter.reset(new Counter());
+        } else if (kind == SAHNE_METRIC_GAUGE) {
+            e.gauge.reset(new Gauge());
+        } else {
+            e.histogram.reset(new Histogram(std::move(bounds)));
+        }
+        entries_.push_back(std::move(e));
+        return static_cast<T*>(entries_.back().get());
+    }
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_;
+};
+
+/// Registry'yi yayınlanmış bir sahne:// kaynağı olarak sunar. İstekler arka plandaki bir iş parçacığında
+/// rpc::Server ile yanıtlanır; her okuma yeni bir anlık görüntü üretir.
+class Exporter {
+public:
+    explicit Exporter(const Registry& registry) : registry_(registry) {}
+    Exporter(const Exporter&) = delete;
+    Exporter& operator=(const Exporter&) = delete;
+    ~Exporter() { stop(); }
+
+    /// "sahne://metrics/<görev id>" adını yayınlar.
+    sahne_error_t start() {
+        sahne_task_id_t task_id = 0;
+        sahne_error_t err = sahne_task_current_id(&task_id);
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        return start(std::string(SAHNE_METRICS_PREFIX) + std::to_string(task_id));
+    }
+
+    /// Verilen adı yayınlar (ikili görüntü "<ad>", metin "<ad>/text").
+    sahne_error_t start(const std::string& name) {
+        stop();
+        sahne_error_t err = sahne_resource_publish(reinterpret_cast<const uint8_t*>(name.data()), name.size(), &channel_);
+        if (err != SAHNE_SUCCESS) {
+            channel_ = 0;
+            return err;
+        }
+        name_ = name;
+        server_.reset(new rpc::Server(1));
+        server_->register_handler(SAHNE_RESOURCE_METHOD_READ,
+            [this](const rpc::RequestContext&, const uint8_t* payload, size_t len, std::vector<uint8_t>& response) {
+                return serve_read(payload, len, response);
+            });
+        server_->add_channel(channel_);
+        thread_ = std::thread([this] { server_->run(); });
+        return SAHNE_SUCCESS;
+    }
+
+    /// Yayını durdurur ve adı kaldırır. start()'tan hemen sonra çağrılabilir: Server::stop() kalıcıdır,
+    /// arka plan iş parçacığı run()'a henüz girmemişse run() hemen döner.
+    void stop() {
+        if (server_) {
+            server_->stop();
+            if (thread_.joinable()) {
+                thread_.join();
+            }
+            server_.reset();
+        }
+        if (channel_ != 0) {
+            sahne_resource_release(channel_);
+        }
+        channel_ = 0;
+        name_.clear();
+    }
+
+    const std::string& name() const { return name_; }
+
+private:
+    sahne_error_t serve_read(const uint8_t* payload, size_t len, std::vector<uint8_t>& response) {
+        SahneResourceReadRequest_t request;
+        if (len < sizeof(request)) {
+            return SAHNE_ERROR_INVALID_PARAMETER;
+        }
+        std::memcpy(&request, payload, sizeof(request));
+        if (request.path_len > len - sizeof(request)) {
+            return SAHNE_ERROR_INVALID_PARAMETER;
+        }
+        std::string path(reinterpret_cast<const char*>(payload + sizeof(request)), request.path_len);
+        std::vector<uint8_t>& image = scratch_;
+        if (path.empty()) {
+            registry_.encode_binary(image, rpc::now_ns());
+        } else if (path == SAHNE_METRICS_TEXT_PATH) {
+            std::string text;
+            registry_.encode_text(text);
+            image.assign(text.begin(), text.end());
+        } else {
+            return SAHNE_ERROR_RESOURCE_NOT_FOUND;
+        }
+        // Ofsetli okumalar her seferinde yeni görüntü üretir; tutarlı görüntü için tek okumada yeterli tampon kullanılmalı
+        size_t begin = static_cast<size_t>(std::min<uint64_t>(request.offset, image.size()));
+        size_t end = begin + std::min<size_t>(request.max_len, image.size() - begin);
+        response.assign(image.begin() + static_cast<std::ptrdiff_t>(begin), image.begin() + static_cast<std::ptrdiff_t>(end));
+        return SAHNE_SUCCESS;
+    }
+
+    const Registry& registry_;
+    std::unique_ptr<rpc::Server> server_;
+    std::thread thread_;
+    sahne_handle_t channel_ = 0;
+    std::string name_;
+    std::vector<uint8_t> scratch_; // Tek işçili sunucu: yalnızca sunucu iş parçacığı kullanır
+};
+
+/// Başka bir görevin metriklerini tek okumada alır (`name` örn. "sahne://metrics/42" veya "…/text").
+/// Görüntü tampona sığmazsa tampon büyütülüp yeniden okunur: ikili görüntüde başlıktaki total_len,
+/// başlıksız metin görüntüsünde tamponun tamamen dolması kesilmeyi gösterir. Birkaç denemeden sonra
+/// hâlâ kesikse (görüntü okumalar arasında büyümeye devam ediyorsa) SAHNE_ERROR_RESOURCE_BUSY döner.
+inline sahne_error_t fetch(const std::string& name, std::vector<uint8_t>& out, size_t initial_capacity = 64 * 1024) {
+    sahne_handle_t handle = 0;
+    sahne_error_t err = sahne_resource_acquire(reinterpret_cast<const uint8_t*>(name.data()), name.size(), SAHNE_MODE_READ, &handle);
+    if (err != SAHNE_SUCCESS) {
+        return err;
+    }
+    const int max_attempts = 4;
+    out.resize(initial_capacity == 0 ? 1 : initial_capacity);
+    for (int attempt = 0;; ++attempt) {
+        size_t n = 0;
+        uint64_t pos = 0;
+        err = sahne_resource_seek(handle, SAHNE_SEEK_SET, 0, &pos);
+        if (err == SAHNE_SUCCESS) {
+            err = sahne_resource_read(handle, out.data(), out.size(), &n);
+        }
+        if (err != SAHNE_SUCCESS) {
+            break;
+        }
+        SahneMetricsHeader_t header;
+        bool binary = false;
+        if (n >= sizeof(header)) {
+            std::memcpy(&header, out.data(), sizeof(header));
+            binary = header.magic == SAHNE_METRICS_MAGIC;
+        }
+        bool truncated = binary ? header.total_len > n : n == out.size();
+        if (!truncated) {
+            out.resize(n);
+            break;
+        }
+        if (attempt + 1 == max_attempts) {
+            err = SAHNE_ERROR_RESOURCE_BUSY;
+            break;
+        }
+        size_t need = binary ? static_cast<size_t>(header.total_len) : out.size() * 2;
+        out.resize(need + need / 4); // Okumalar arasındaki büyümeye pay bırak
+    }
+    sahne_resource_release(handle);
+    return err;
+}
+
+} // namespace metrics
+} // namespace sahne
+
+#endif // SAHNE_METRICS_HPP
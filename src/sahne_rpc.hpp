@@ -0,0 +1,500 @@
+#ifndef SAHNE_RPC_HPP
+#define SAHNE_RPC_HPP
+
+// Sahne64 kanalları üzerinde istek/yanıt (RPC) katmanı.
+// Çerçeve formatı sahne.h'deki SahneRpcHeader_t'dir; her RPC mesajı tek bir kanal mesajıdır.
+// - Client: tek bir kanal handle'ı üzerinde çok sayıda bekleyen isteği boru hattı (pipelining) ile taşır.
+//   İstekler toplanıp sahne_channel_send_many ile tek çağrıda gönderilir, yanıtlar request_id ile eşleştirilir.
+// - Server: sahne_poll ile birden çok kanalı dinler ve işleyicileri bir iş parçacığı havuzunda çalıştırır.
+// Son tarihler (deadline) mutlak zaman olarak başlıkta taşınır; sunucu işleyicisi aynı son tarihi
+// alt çağrılarına aktarabilir (RequestContext::deadline_ns).
+
+#include "sahne.h"
+#include "sahne.hpp"
+
+#include <atomic>             // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <cstdint>
+#include <cstring>            // std::memcpy
+#include <deque>              // std::deque
+#include <functional>         // std::function
+#include <mutex>              // std::mutex
+#include <set>                // std::set
+#include <thread>             // std::thread
+#include <unordered_map>      // std::unordered_map
+#include <utility>            // std::pair, std::move
+#include <vector>
+
+namespace sahne {
+namespace rpc {
+
+constexpr size_t kHeaderSize = sizeof(SahneRpcHeader_t);
+
+/// sahne_kernel_get_time saatine göre şimdiki zaman (ns). Saat okunamazsa 0 döner.
+inline uint64_t now_ns() {
+    uint64_t t = 0;
+    return sahne_kernel_get_time(&t) == SAHNE_SUCCESS ? t : 0;
+}
+
+/// Göreli süreyi (ns) mutlak son tarihe çevirir. 0 süre "son tarih yok" demektir.
+/// Çok uzun süreler geçmişe sarmak yerine SAHNE_RPC_NO_DEADLINE - 1'de (UINT64_MAX) doyar.
+inline uint64_t deadline_after(uint64_t timeout_ns) {
+    if (timeout_ns == 0) {
+        return SAHNE_RPC_NO_DEADLINE;
+    }
+    const uint64_t latest = SAHNE_RPC_NO_DEADLINE - uint64_t{1};
+    uint64_t now = now_ns();
+    return timeout_ns > latest - now ? latest : now + timeout_ns;
+}
+
+/// Başlık ve veriyi tek bir mesaj tamponuna yazar.
+inline void encode(const SahneRpcHeader_t& header, const uint8_t* payload, std::vector<uint8_t>& out) {
+    out.resize(kHeaderSize + header.payload_len);
+    std::memcpy(out.data(), &header, kHeaderSize);
+    if (header.payload_len != 0) {
+        std::memcpy(out.data() + kHeaderSize, payload, header.payload_len);
+    }
+}
+
+/// Bir kanal mesajını çözer. Başlık bozuksa SAHNE_ERROR_COMMUNICATION_ERROR döner.
+inline sahne_error_t decode(const uint8_t* msg, size_t len, SahneRpcHeader_t* out_header, const uint8_t** out_payload) {
+    if (len < kHeaderSize) {
+        return SAHNE_ERROR_COMMUNICATION_ERROR;
+    }
+    std::memcpy(out_header, msg, kHeaderSize);
+    if (out_header->version != SAHNE_RPC_VERSION || out_header->payload_len != len - kHeaderSize) {
+        return SAHNE_ERROR_COMMUNICATION_ERROR;
+    }
+    *out_payload = msg + kHeaderSize;
+    return SAHNE_SUCCESS;
+}
+
+/// Tek bir kanal üzerinde boru hattı (pipelined) RPC istemcisi.
+/// Tek iş parçacığından kullanılmak üzere tasarlanmıştır: call_async istekleri kuyruğa ekler,
+/// poll kuyruğu gönderir, yanıtları toplar ve geri çağırmaları (callback) aynı iş parçacığında çalıştırır.
+class Client {
+public:
+    using ResponseCallback = std::function<void(sahne_error_t status, const uint8_t* data, size_t len)>;
+
+    explicit Client(sahne_handle_t channel_handle, size_t rx_buffer_bytes = 64 * 1024, size_t rx_max_messages = 256)
+        : channel_(channel_handle), tx_(rx_buffer_bytes), rx_(rx_buffer_bytes, rx_max_messages) {}
+
+    /// Bir isteği mutlak son tarihle kuyruğa ekler; istek bir sonraki flush/poll çağrısında gönderilir.
+    sahne_error_t call_async_until(uint32_t method, const uint8_t* payload, size_t len, uint64_t deadline_ns,
+                                   ResponseCallback callback, uint64_t* out_request_id = nullptr) {
+        if (len > UINT32_MAX) {
+            return SAHNE_ERROR_INVALID_PARAMETER;
+        }
+        SahneRpcHeader_t header{};
+        header.version = SAHNE_RPC_VERSION;
+        header.kind = SAHNE_RPC_KIND_REQUEST;
+        header.method = method;
+        header.request_id = next_id_++;
+        header.deadline_ns = deadline_ns;
+        header.payload_len = static_cast<uint32_t>(len);
+        encode(header, payload, scratch_);
+        sahne_error_t err = tx_.push(scratch_.data(), scratch_.size());
+        if (err != SAHNE_SUCCESS) {
+            --next_id_;
+            return err; // Başlıkla birlikte çerçeveye sığmıyor
+        }
+
+        pending_.emplace(header.request_id, Pending{deadline_ns, std::move(callback)});
+        if (deadline_ns != SAHNE_RPC_NO_DEADLINE) {
+            deadlines_.emplace(deadline_ns, header.request_id);
+        }
+        if (out_request_id != nullptr) {
+            *out_request_id = header.request_id;
+        }
+        return SAHNE_SUCCESS;
+    }
+
+    /// Bir isteği göreli zaman aşımıyla (ns, 0 = sınırsız) kuyruğa ekler.
+    sahne_error_t call_async(uint32_t method, const uint8_t* payload, size_t len, uint64_t timeout_ns,
+                             ResponseCallback callback, uint64_t* out_request_id = nullptr) {
+        return call_async_until(method, payload, len, deadline_after(timeout_ns), std::move(callback), out_request_id);
+    }
+
+    /// Bekleyen bir isteği iptal eder; geri çağırma SAHNE_ERROR_INTERRUPTED ile hemen çalışır.
+    /// CANCEL çerçeveye sığmazsa kuyruk gönderilip bir kez daha denenir; yine olmazsa hata döner
+    /// ve istek beklemede kalır.
+    sahne_error_t cancel(uint64_t request_id) {
+        auto it = pending_.find(request_id);
+        if (it == pending_.end()) {
+            return SAHNE_ERROR_RESOURCE_NOT_FOUND;
+        }
+        SahneRpcHeader_t header{};
+        header.version = SAHNE_RPC_VERSION;
+        header.kind = SAHNE_RPC_KIND_CANCEL;
+        header.request_id = request_id;
+        encode(header, nullptr, scratch_);
+        sahne_error_t err = tx_.push(scratch_.data(), scratch_.size());
+        if (err != SAHNE_SUCCESS) {
+            err = flush();
+            if (err == SAHNE_SUCCESS) {
+                err = tx_.push(scratch_.data(), scratch_.size());
+            }
+            if (err != SAHNE_SUCCESS) {
+                return err;
+            }
+        }
+        complete(it, SAHNE_ERROR_INTERRUPTED, nullptr, 0);
+        return SAHNE_SUCCESS;
+    }
+
+    /// Kuyruktaki istekleri tek sahne_channel_send_many çağrısıyla gönderir.
+    sahne_error_t flush() {
+        while (!tx_.empty()) {
+            size_t sent = 0;
+            sahne_error_t err = tx_.flush(channel_, &sent);
+            if (err != SAHNE_SUCCESS) {
+                return err; // WOULD_BLOCK: kalanlar bir sonraki poll'da tekrar denenir
+            }
+        }
+        return SAHNE_SUCCESS;
+    }
+
+    /// Kuyruğu gönderir, en fazla timeout_ms (-1 sonsuz) kadar yanıt bekler ve gelen yanıtları işler.
+    /// Son tarihi geçen istekler SAHNE_ERROR_TIMED_OUT ile tamamlanır.
+    sahne_error_t poll(int64_t timeout_ms, size_t* out_completed = nullptr) {
+        size_t completed = 0;
+        sahne_error_t err = flush();
+        if (err != SAHNE_SUCCESS && err != SAHNE_ERROR_WOULD_BLOCK) {
+            return err;
+        }
+        if (!pending_.empty()) {
+            PollEntry_t entry{};
+            entry.handle = channel_;
+            entry.events_in = SAHNE_POLL_READABLE | SAHNE_POLL_DISCONNECTED;
+            int64_t ready = sahne_poll(&entry, 1, clamp_to_deadline(timeout_ms));
+            if (ready < 0) {
+                return map_kernel_error(ready);
+            }
+            if (entry.events_out & SAHNE_POLL_READABLE) {
+                err = drain(&completed);
+                if (err != SAHNE_SUCCESS) {
+                    return err;
+                }
+            } else if (entry.events_out & SAHNE_POLL_DISCONNECTED) {
+                fail_all(SAHNE_ERROR_DISCONNECTED, &completed);
+            }
+        }
+        expire(now_ns(), &completed);
+        if (out_completed != nullptr) {
+            *out_completed = completed;
+        }
+        return SAHNE_SUCCESS;
+    }
+
+    /// Senkron çağrı: isteği gönderir ve yanıt gelene veya son tarih geçene kadar bekler.
+    sahne_error_t call(uint32_t method, const uint8_t* payload, size_t len, uint64_t timeout_ns, std::vector<uint8_t>* out_response) {
+        bool done = false;
+        sahne_error_t result = SAHNE_SUCCESS;
+        sahne_error_t err = call_async(method, payload, len, timeout_ns,
+            [&](sahne_error_t status, const uint8_t* data, size_t data_len) {
+                done = true;
+                result = status;
+                if (out_response != nullptr) {
+                    out_response->assign(data, data + data_len);
+                }
+            });
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        while (!done) {
+            err = poll(-1);
+            if (err != SAHNE_SUCCESS) {
+                return err;
+            }
+        }
+        return result;
+    }
+
+    size_t pending() const { return pending_.size(); }
+
+private:
+    struct Pending {
+        uint64_t deadline_ns;
+        ResponseCallback callback;
+    };
+    using PendingMap = std::unordered_map<uint64_t, Pending>;
+
+    void complete(PendingMap::iterator it, sahne_error_t status, const uint8_t* data, size_t len) {
+        Pending p = std::move(it->second);
+        if (p.deadline_ns != SAHNE_RPC_NO_DEADLINE) {
+            deadlines_.erase({p.deadline_ns, it->first});
+        }
+        pending_.erase(it);
+        if (p.callback) {
+            p.callback(status, data, len);
+        }
+    }
+
+    sahne_error_t drain(size_t* completed) {
+        sahne_error_t err = rx_.receive(channel_);
+        if (err == SAHNE_ERROR_NO_MESSAGE || err == SAHNE_ERROR_WOULD_BLOCK) {
+            return SAHNE_SUCCESS;
+        }
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        for (size_t i = 0; i < rx_.count(); ++i) {
+            SahneRpcHeader_t header;
+            const uint8_t* payload = nullptr;
+            if (decode(rx_.message_data(i), rx_.message_len(i), &header, &payload) != SAHNE_SUCCESS
+                || header.kind != SAHNE_RPC_KIND_RESPONSE) {
+                continue; // Bozuk veya beklenmeyen mesaj
+            }
+            auto it = pending_.find(header.request_id);
+            if (it == pending_.end()) {
+                continue; // Zaman aşımına uğramış veya iptal edilmiş isteğin geç yanıtı
+            }
+            complete(it, header.status, payload, header.payload_len);
+            ++*completed;
+        }
+        return SAHNE_SUCCESS;
+    }
+
+    void expire(uint64_t now, size_t* completed) {
+        while (!deadlines_.empty() && deadlines_.begin()->first <= now) {
+            auto it = pending_.find(deadlines_.begin()->second);
+            if (it == pending_.end()) {
+                deadlines_.erase(deadlines_.begin());
+                continue;
+            }
+            complete(it, SAHNE_ERROR_TIMED_OUT, nullptr, 0);
+            ++*completed;
+        }
+    }
+
+    void fail_all(sahne_error_t status, size_t* completed) {
+        while (!pending_.empty()) {
+            complete(pending_.begin(), status, nullptr, 0);
+            ++*completed;
+        }
+    }
+
+    // Poll bekleme süresini en yakın son tarihe göre kısaltır.
+    int64_t clamp_to_deadline(int64_t timeout_ms) const {
+        if (deadlines_.empty()) {
+            return timeout_ms;
+        }
+        uint64_t now = now_ns();
+        uint64_t first = deadlines_.begin()->first;
+        int64_t until_ms = first <= now ? 0 : static_cast<int64_t>((first - now + 999999) / 1000000);
+        return (timeout_ms < 0 || until_ms < timeout_ms) ? until_ms : timeout_ms;
+    }
+
+    sahne_handle_t channel_;
+    uint64_t next_id_ = 1;
+    PendingMap pending_;
+    std::set<std::pair<uint64_t, uint64_t>> deadlines_; // (deadline_ns, request_id)
+    messaging::FrameBuilder tx_;
+    messaging::ReceiveBatch rx_;
+    std::vector<uint8_t> scratch_;
+};
+
+/// Sunucu işleyicisine verilen istek bilgileri.
+struct RequestContext {
+    sahne_handle_t channel;
+    uint64_t request_id;
+    uint32_t method;
+    uint64_t deadline_ns; // Alt çağrılara (Client::call_async_until) aynen aktarılabilir
+
+    bool expired() const { return deadline_ns != SAHNE_RPC_NO_DEADLINE && now_ns() >= deadline_ns; }
+};
+
+/// Bir RPC metodu işleyicisi. Yanıt verisini `response`'a yazar ve yanıt durumunu döner.
+using Handler = std::function<sahne_error_t(const RequestContext& ctx, const uint8_t* payload, size_t len, std::vector<uint8_t>& response)>;
+
+/// Birden çok kanalı sahne_poll ile dinleyen ve işleyicileri iş parçacığı havuzunda çalıştıran RPC sunucusu.
+class Server {
+public:
+    explicit Server(size_t worker_count, size_t rx_buffer_bytes = 64 * 1024, size_t rx_max_messages = 256)
+        : rx_(rx_buffer_bytes, rx_max_messages) {
+        if (worker_count == 0) {
+            worker_count = 1;
+        }
+        workers_.reserve(worker_count);
+        for (size_t i = 0; i < worker_count; ++i) {
+            workers_.emplace_back([this] { worker_loop(); });
+        }
+    }
+
+    Server(const Server&) = delete;
+    Server& operator=(const Server&) = delete;
+
+    /// Başka bir iş parçacığında çalışan run() varsa dönmesini bekler; run() nesne yok edildikten
+    /// sonra başlatılmamalıdır (stop() öncesinde başlamamış run() hemen döner).
+    ~Server() {
+        stop();
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            run_cv_.wait(lock, [this] { return !running_; });
+            shutting_down_ = true;
+        }
+        cv_.notify_all();
+        for (auto& w : workers_) {
+            w.join();
+        }
+    }
+
+    /// Metod numarasına işleyici bağlar. run() başlamadan önce çağrılmalıdır.
+    void register_handler(uint32_t method, Handler handler) {
+        handlers_[method] = std::move(handler);
+    }
+
+    /// Dinlenecek bir istemci kanalı ekler. run() başlamadan önce çağrılmalıdır.
+    void add_channel(sahne_handle_t channel_handle) {
+        PollEntry_t entry{};
+        entry.handle = channel_handle;
+        entry.events_in = SAHNE_POLL_READABLE | SAHNE_POLL_DISCONNECTED;
+        entries_.push_back(entry);
+    }
+
+    /// Gelen istekleri stop() çağrılana veya tüm kanallar kapanana kadar dağıtır (çağıran iş parçacığında).
+    /// stop() kalıcıdır: run() başlamadan önce çağrılmışsa run() hemen döner.
+    sahne_error_t run() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stop_requested_) {
+                return SAHNE_SUCCESS;
+            }
+            running_ = true;
+        }
+        sahne_error_t err = run_loop();
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+        run_cv_.notify_all(); // Kilit altında: yıkıcı uyanınca run_cv_'yi yok edebilir
+        return err;
+    }
+
+    /// run() döngüsünün durmasını ister (herhangi bir iş parçacığından çağrılabilir).
+    void stop() { stop_requested_ = true; }
+
+private:
+    struct Job {
+        RequestContext ctx;
+        std::vector<uint8_t> payload;
+    };
+
+    sahne_error_t run_loop() {
+        while (!stop_requested_ && !entries_.empty()) {
+            for (auto& e : entries_) {
+                e.events_out = SAHNE_POLL_NONE;
+            }
+            // stop() isteğini fark edebilmek için sınırlı süre bekle
+            int64_t ready = sahne_poll(entries_.data(), entries_.size(), 100);
+            if (ready < 0) {
+                sahne_error_t err = map_kernel_error(ready);
+                if (err == SAHNE_ERROR_INTERRUPTED) {
+                    continue;
+                }
+                return err;
+            }
+            for (size_t i = 0; i < entries_.size();) {
+                if (entries_[i].events_out & SAHNE_POLL_READABLE) {
+                    dispatch(entries_[i].handle);
+                }
+                if (entries_[i].events_out & SAHNE_POLL_DISCONNECTED) {
+                    entries_.erase(entries_.begin() + static_cast<std::ptrdiff_t>(i));
+                    continue;
+                }
+                ++i;
+            }
+        }
+        return SAHNE_SUCCESS;
+    }
+
+    void dispatch(sahne_handle_t channel) {
+        if (rx_.receive(channel) != SAHNE_SUCCESS) {
+            return; // NO_MESSAGE/WOULD_BLOCK veya kanal hatası; poll bir sonraki turda bildirir
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < rx_.count(); ++i) {
+            SahneRpcHeader_t header;
+            const uint8_t* payload = nullptr;
+            if (decode(rx_.message_data(i), rx_.message_len(i), &header, &payload) != SAHNE_SUCCESS) {
+                continue;
+            }
+            if (header.kind == SAHNE_RPC_KIND_CANCEL) {
+                // Yalnızca henüz başlamamış işler iptal edilebilir
+                for (auto it = queue_.begin(); it != queue_.end(); ++it) {
+                    if (it->ctx.channel == channel && it->ctx.request_id == header.request_id) {
+                        queue_.erase(it);
+                        break;
+                    }
+                }
+                continue;
+            }
+            if (header.kind != SAHNE_RPC_KIND_REQUEST) {
+                continue;
+            }
+            Job job{RequestContext{channel, header.request_id, header.method, header.deadline_ns},
+                    std::vector<uint8_t>(payload, payload + header.payload_len)};
+            queue_.push_back(std::move(job));
+        }
+        cv_.notify_all();
+    }
+
+    void worker_loop() {
+        std::vector<uint8_t> response;
+        std::vector<uint8_t> message;
+        for (;;) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return shutting_down_ || !queue_.empty(); });
+                if (queue_.empty()) {
+                    return; // Kapanış ve kuyruk boş
+                }
+                job = std::move(queue_.front());
+                queue_.pop_front();
+            }
+
+            response.clear();
+            sahne_error_t status;
+            if (job.ctx.expired()) {
+                status = SAHNE_ERROR_TIMED_OUT; // İstemci artık beklemiyor, işleyiciyi çalıştırma
+            } else {
+                auto it = handlers_.find(job.ctx.method);
+                status = it == handlers_.end()
+                    ? SAHNE_ERROR_NOT_SUPPORTED
+                    : it->second(job.ctx, job.payload.data(), job.payload.size(), response);
+            }
+            if (response.size() > UINT32_MAX) {
+                response.clear();
+                status = SAHNE_ERROR_INVALID_PARAMETER;
+            }
+
+            SahneRpcHeader_t header{};
+            header.version = SAHNE_RPC_VERSION;
+            header.kind = SAHNE_RPC_KIND_RESPONSE;
+            header.method = job.ctx.method;
+            header.request_id = job.ctx.request_id;
+            header.deadline_ns = job.ctx.deadline_ns;
+            header.status = status;
+            header.payload_len = static_cast<uint32_t>(response.size());
+            encode(header, response.data(), message);
+            sahne_channel_send(job.ctx.channel, message.data(), message.size()); // Kanal kapandıysa yanıt düşer
+        }
+    }
+
+    std::unordered_map<uint32_t, Handler> handlers_;
+    std::vector<PollEntry_t> entries_;
+    messaging::ReceiveBatch rx_;
+    std::atomic<bool> stop_requested_{false};
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable run_cv_;
+    bool running_ = false; // run() çalışıyor (mutex_ ile korunur)
+    std::deque<Job> queue_;
+    bool shutting_down_ = false;
+    std::vector<std::thread> workers_;
+};
+
+} // namespace rpc
+} // namespace sahne
+
+#endif // SAHNE_RPC_HPP
@@ -0,0 +1,346 @@
+#ifndef SAHNE_TASK_POOL_HPP
+#define SAHNE_TASK_POOL_HPP
+
+// Önceden başlatılmış (warm) görev havuzu.
+// Her iş için sahne_task_spawn + sahne_task_wait_for_exit maliyeti ödemek yerine, havuz sabit sayıda
+// işçi görevi bir kanal üzerinde bekletir ve işleri (argümanlar + başlangıç handle'ları) onlara dağıtır.
+// İşçiler normal kod handle'ından veya bir görev şablonundan (sahne_task_template_create) başlatılabilir;
+// şablon kullanıldığında işçi yeniden başlatma maliyeti copy-on-write klon maliyetine iner.
+//
+// Kanal protokolü (her iki yönde tek kanal mesajı):
+//   iş:    [JobHeader][argümanlar] + en fazla SAHNE_CHANNEL_MAX_HANDLES handle
+//   sonuç: [ResultHeader]
+
+#include "sahne.h"
+#include "sahne.hpp"
+
+#include <cstdint>
+#include <cstring>       // std::memcpy
+#include <deque>         // std::deque
+#include <functional>    // std::function
+#include <unordered_map> // std::unordered_map
+#include <utility>       // std::move
+#include <vector>
+
+namespace sahne {
+namespace task_pool {
+
+struct JobHeader {
+    uint64_t job_id;
+};
+
+struct ResultHeader {
+    uint64_t job_id;
+    int32_t result; // İşçi işleyicisinin dönüş değeri
+    uint32_t reserved;
+};
+
+/// İşçi görev tarafındaki iş işleyicisi. Alınan handle'lar işleyicinindir (işi bitince bırakmalıdır).
+using WorkerHandler = std::function<int32_t(const uint8_t* args, size_t args_len, const sahne_handle_t* handles, size_t handles_len)>;
+
+/// İşçi görevin ana döngüsü: ilk başlangıç handle'ı (havuz kanalı) üzerinden işleri alır ve sonuçları gönderir.
+/// Havuz kanalı kapanınca 0 ile döner. Şablon kullanan işçiler bunu sahne_task_template_checkpoint sonrasında çağırmalıdır:
+///     pahali_ilklendirme();
+///     size_t n = 0;
+///     sahne_task_template_checkpoint(nullptr, 0, &n);
+///     sahne_task_exit(sahne::task_pool::run_worker(isleyici));
+inline int32_t run_worker(const WorkerHandler& handler, size_t max_args_bytes = 64 * 1024) {
+    sahne_handle_t channel = 0;
+    size_t count = 0;
+    sahne_error_t err = sahne_task_get_initial_handles(&channel, 1, &count);
+    if (err != SAHNE_SUCCESS || count == 0) {
+        return SAHNE_ERROR_INVALID_HANDLE;
+    }
+
+    std::vector<uint8_t> buffer(sizeof(JobHeader) + max_args_bytes);
+    sahne_handle_t handles[SAHNE_CHANNEL_MAX_HANDLES];
+    for (;;) {
+        ChannelEnvelope_t envelope{};
+        envelope.data = buffer.data();
+        envelope.data_cap = buffer.size();
+        envelope.handles = handles;
+        envelope.handles_cap = SAHNE_CHANNEL_MAX_HANDLES;
+        err = sahne_channel_receive_with_handles(channel, &envelope);
+        if (err == SAHNE_ERROR_DISCONNECTED) {
+            return 0; // Havuz kapatıldı
+        }
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        if (envelope.data_len < sizeof(JobHeader)) {
+            continue;
+        }
+
+        ResultHeader result{};
+        std::memcpy(&result.job_id, buffer.data(), sizeof(uint64_t));
+        result.result = handler(buffer.data() + sizeof(JobHeader), envelope.data_len - sizeof(JobHeader),
+                                handles, envelope.handles_len);
+        err = sahne_channel_send(channel, reinterpret_cast<const uint8_t*>(&result), sizeof(result));
+        if (err == SAHNE_ERROR_DISCONNECTED) {
+            return 0;
+        }
+    }
+}
+
+/// Ebeveyn tarafı: işçi görevleri başlatır, işleri boştaki işçilere dağıtır ve sonuçları toplar.
+/// Tek iş parçacığından kullanılmak üzere tasarlanmıştır (tamamlama geri çağırmaları poll içinde çalışır).
+class TaskPool {
+public:
+    using Completion = std::function<void(sahne_error_t status, int32_t result)>;
+
+    struct Options {
+        sahne_handle_t code_handle = 0;     // İşçi kodu (template_handle verilmezse kullanılır)
+        sahne_handle_t template_handle = 0; // sahne_task_template_create ile oluşturulmuş şablon (tercih edilir)
+        size_t workers = 4;
+    };
+
+    TaskPool() = default;
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+    ~TaskPool() { shutdown(); }
+
+    /// İşçileri başlatır. Başarısız olursa o ana kadar başlatılanlar kapatılır.
+    sahne_error_t start(const Options& options) {
+        options_ = options;
+        if (options_.workers == 0 || (options_.code_handle == 0 && options_.template_handle == 0)) {
+            return SAHNE_ERROR_INVALID_PARAMETER;
+        }
+        workers_.resize(options_.workers);
+        for (size_t i = 0; i < workers_.size(); ++i) {
+            sahne_error_t err = spawn_worker(i);
+            if (err != SAHNE_SUCCESS) {
+                shutdown();
+                return err;
+            }
+        }
+        return SAHNE_SUCCESS;
+    }
+
+    /// Bir işi kuyruğa ekler ve boşta işçi varsa hemen gönderir. Handle'lar işçiye taşınır.
+    /// İş kuyruğa alındıysa SAHNE_SUCCESS döner ve handle'lar artık havuzundur (gönderilemezlerse
+    /// shutdown() bırakır); gönderim hataları bir sonraki poll() çağrısında bildirilir.
+    sahne_error_t submit(const uint8_t* args, size_t args_len, const sahne_handle_t* handles, size_t handles_len,
+                         Completion completion, uint64_t* out_job_id = nullptr) {
+        if (handles_len > SAHNE_CHANNEL_MAX_HANDLES) {
+            return SAHNE_ERROR_INVALID_PARAMETER;
+        }
+        Job job;
+        job.id = next_job_id_++;
+        job.message.resize(sizeof(JobHeader) + args_len);
+        std::memcpy(job.message.data(), &job.id, sizeof(uint64_t));
+        if (args_len != 0) {
+            std::memcpy(job.message.data() + sizeof(JobHeader), args, args_len);
+        }
+        job.handles.assign(handles, handles + handles_len);
+        job.completion = std::move(completion);
+        if (out_job_id != nullptr) {
+            *out_job_id = job.id;
+        }
+        queue_.push_back(std::move(job));
+        pending_error_ = dispatch();
+        return SAHNE_SUCCESS;
+    }
+
+    /// Tamamlanan işleri en fazla timeout_ms (-1 sonsuz) bekleyerek toplar ve kuyruktaki işleri dağıtır.
+    /// Ölen (veya bozuk sonuç gönderen) bir işçinin işi hata ile tamamlanır ve işçi yeniden başlatılır;
+    /// yeniden başlatılamayan işçiler sonraki poll çağrılarında tekrar denenir.
+    sahne_error_t poll(int64_t timeout_ms, size_t* out_completed = nullptr) {
+        size_t completed = 0;
+        sahne_error_t first_error = pending_error_;
+        pending_error_ = SAHNE_SUCCESS;
+        entries_.clear();
+        entry_workers_.clear();
+        for (size_t i = 0; i < workers_.size(); ++i) {
+            if (workers_[i].channel == 0) {
+                sahne_error_t err = spawn_worker(i); // Önceki yeniden başlatma başarısız olmuş
+                if (err != SAHNE_SUCCESS) {
+                    if (first_error == SAHNE_SUCCESS) {
+                        first_error = err;
+                    }
+                    continue;
+                }
+            }
+            PollEntry_t entry{};
+            entry.handle = workers_[i].channel;
+            entry.events_in = SAHNE_POLL_READABLE | SAHNE_POLL_DISCONNECTED;
+            entries_.push_back(entry);
+            entry_workers_.push_back(i);
+        }
+        if (!entries_.empty()) {
+            int64_t ready = sahne_poll(entries_.data(), entries_.size(), in_flight_.empty() ? 0 : timeout_ms);
+            if (ready < 0) {
+                return map_kernel_error(ready);
+            }
+        }
+        for (size_t e = 0; e < entries_.size(); ++e) {
+            size_t i = entry_workers_[e];
+            Worker& w = workers_[i];
+            sahne_error_t status = SAHNE_SUCCESS;
+            if (entries_[e].events_out & SAHNE_POLL_READABLE) {
+                ResultHeader result{};
+                size_t received = 0;
+                status = sahne_channel_receive(w.channel, reinterpret_cast<uint8_t*>(&result), sizeof(result), &received);
+                if (status == SAHNE_SUCCESS && received == sizeof(result)) {
+                    finish(result.job_id, SAHNE_SUCCESS, result.result);
+                    w.busy = false;
+                    ++completed;
+                    continue;
+                }
+                if (status == SAHNE_ERROR_NO_MESSAGE || status == SAHNE_ERROR_WOULD_BLOCK) {
+                    continue; // Sahte uyanış
+                }
+                if (status == SAHNE_SUCCESS) {
+                    status = SAHNE_ERROR_INVALID_OPERATION; // Kısa sonuç: protokol bozuk
+                }
+            } else if (entries_[e].events_out & SAHNE_POLL_DISCONNECTED) {
+                status = SAHNE_ERROR_DISCONNECTED;
+            } else {
+                continue;
+            }
+            // İşçi artık güvenilir değil: işini hata ile bitir ve yerine yenisini başlat
+            if (w.busy) {
+                finish(w.job_id, status, 0);
+                ++completed;
+            }
+            reap(w);
+            sahne_error_t err = spawn_worker(i);
+            if (err != SAHNE_SUCCESS && first_error == SAHNE_SUCCESS) {
+                first_error = err;
+            }
+        }
+        sahne_error_t err = dispatch();
+        if (out_completed != nullptr) {
+            *out_completed = completed;
+        }
+        return first_error != SAHNE_SUCCESS ? first_error : err;
+    }
+
+    /// Kanal uçlarını kapatır (işçiler DISCONNECTED görüp çıkar) ve işçilerin sonlanmasını bekler.
+    /// Bekleyen ve kuyruktaki işler SAHNE_ERROR_INTERRUPTED ile tamamlanır.
+    void shutdown() {
+        for (auto& w : workers_) {
+            reap(w);
+        }
+        workers_.clear();
+        for (auto& entry : in_flight_) {
+            if (entry.second) {
+                entry.second(SAHNE_ERROR_INTERRUPTED, 0);
+            }
+        }
+        in_flight_.clear();
+        while (!queue_.empty()) {
+            Job job = std::move(queue_.front());
+            queue_.pop_front();
+            for (sahne_handle_t h : job.handles) {
+                sahne_resource_release(h); // Gönderilemeyen handle'ları sızdırma
+            }
+            if (job.completion) {
+                job.completion(SAHNE_ERROR_INTERRUPTED, 0);
+            }
+        }
+    }
+
+    size_t queued() const { return queue_.size(); }
+    size_t in_flight() const { return in_flight_.size(); }
+
+private:
+    struct Worker {
+        sahne_handle_t channel = 0;
+        sahne_task_id_t task_id = 0;
+        bool busy = false;
+        uint64_t job_id = 0;
+    };
+
+    struct Job {
+        uint64_t id = 0;
+        std::vector<uint8_t> message;
+        std::vector<sahne_handle_t> handles;
+        Completion completion;
+    };
+
+    sahne_error_t spawn_worker(size_t index) {
+        sahne_handle_t parent_end = 0;
+        sahne_handle_t child_end = 0;
+        sahne_error_t err = sahne_channel_create_pair(&parent_end, &child_end);
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        sahne_task_id_t task_id = 0;
+        if (options_.template_handle != 0) {
+            err = sahne_task_spawn_from_template(options_.template_handle, nullptr, 0, &child_end, 1, &task_id);
+        } else {
+            err = sahne_task_spawn(options_.code_handle, nullptr, 0, &child_end, 1, &task_id);
+        }
+        if (err != SAHNE_SUCCESS) {
+            sahne_resource_release(parent_end);
+            sahne_resource_release(child_end); // Spawn başarısızsa handle bizde kalır
+            return err;
+        }
+        workers_[index] = Worker{parent_end, task_id, false, 0};
+        return SAHNE_SUCCESS;
+    }
+
+    void reap(Worker& w) {
+        if (w.channel != 0) {
+            sahne_resource_release(w.channel);
+            w.channel = 0;
+        }
+        if (w.task_id != 0) {
+            int32_t exit_code = 0;
+            sahne_task_wait_for_exit(w.task_id, &exit_code);
+            w.task_id = 0;
+        }
+        w.busy = false;
+    }
+
+    sahne_error_t dispatch() {
+        for (auto& w : workers_) {
+            if (queue_.empty()) {
+                break;
+            }
+            if (w.busy || w.channel == 0) {
+                continue;
+            }
+            Job& job = queue_.front();
+            sahne_error_t err = sahne_channel_send_with_handles(w.channel, job.message.data(), job.message.size(),
+                                                                job.handles.empty() ? nullptr : job.handles.data(), job.handles.size());
+            if (err == SAHNE_ERROR_WOULD_BLOCK || err == SAHNE_ERROR_DISCONNECTED) {
+                continue; // Bu işçi şu an alamıyor; poll DISCONNECTED'ı ayrıca işler
+            }
+            if (err != SAHNE_SUCCESS) {
+                return err;
+            }
+            w.busy = true;
+            w.job_id = job.id;
+            in_flight_.emplace(job.id, std::move(job.completion));
+            queue_.pop_front();
+        }
+        return SAHNE_SUCCESS;
+    }
+
+    void finish(uint64_t job_id, sahne_error_t status, int32_t result) {
+        auto it = in_flight_.find(job_id);
+        if (it == in_flight_.end()) {
+            return;
+        }
+        Completion completion = std::move(it->second);
+        in_flight_.erase(it);
+        if (completion) {
+            completion(status, result);
+        }
+    }
+
+    Options options_;
+    std::vector<Worker> workers_;
+    std::vector<PollEntry_t> entries_;
+    std::vector<size_t> entry_workers_; // entries_[e] -> workers_ indeksi
+    std::deque<Job> queue_;
+    std::unordered_map<uint64_t, Completion> in_flight_;
+    uint64_t next_job_id_ = 1;
+    sahne_error_t pending_error_ = SAHNE_SUCCESS; // submit() içindeki gönderim hatası, poll() bildirir
+};
+
+} // namespace task_pool
+} // namespace sahne
+
+#endif // SAHNE_TASK_POOL_HPP
@@ -0,0 +1,269 @@
+#ifndef SAHNE_TIMER_WHEEL_HPP
+#define SAHNE_TIMER_WHEEL_HPP
+
+// Kullanıcı alanı hiyerarşik zamanlayıcı çarkı (sahne64.rs timer::TimerWheel ile aynı algoritma).
+// Milyonlarca mantıksal zamanlayıcıyı (örn. bağlantı başına zaman aşımları) tek bir çekirdek zamanlayıcı
+// handle'ına (sahne_timer_create) bağlar: çekirdek zamanlayıcısı her zaman en yakın dolma anına kurulur,
+// böylece poll uyanışlarında tüm oturumları taramak gerekmez.
+//
+// 4 seviye x 64 yuva; seviye L'deki bir yuva 64^L tik genişliğindedir. Ekleme/iptal O(1)'dir.
+// Tipik döngü:
+//     wheel.arm(timer_handle);                     // poll kümesinde timer_handle READABLE beklenir
+//     ... timer_handle READABLE ...
+//     sahne::timer::read_expirations(timer_handle, &n);
+//     wheel.advance(now_ns, on_fire);              // now_ns: sahne_get_time_ns benzeri monoton saat
+//     wheel.arm(timer_handle);
+
+#include "sahne.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace sahne {
+namespace timer {
+
+/// Son okumadan beri dolma sayısını okur ve sıfırlar.
+inline sahne_error_t read_expirations(sahne_handle_t timer_handle, uint64_t* out_count) {
+    size_t bytes_read = 0;
+    sahne_error_t err = sahne_resource_read(timer_handle, reinterpret_cast<uint8_t*>(out_count), sizeof(uint64_t), &bytes_read);
+    if (err == SAHNE_SUCCESS && bytes_read != sizeof(uint64_t)) {
+        return SAHNE_ERROR_INVALID_OPERATION;
+    }
+    return err;
+}
+
+/// Çarka eklenmiş bir zamanlayıcıyı tanımlar (iptal için).
+struct TimerId {
+    uint32_t index;
+    uint32_t generation;
+};
+
+class TimerWheel {
+public:
+    /// `tick_ns` çözünürlüğünde, `now_ns` anından başlayan bir çark oluşturur.
+    TimerWheel(uint64_t tick_ns, uint64_t now_ns, size_t reserve = 0)
+        : tick_ns_(tick_ns == 0 ? 1 : tick_ns), origin_ns_(now_ns) {
+        nodes_.reserve(reserve);
+        for (auto& level : heads_) {
+            for (auto& head : level) {
+                head = kNil;
+            }
+        }
+    }
+
+    size_t size() const { return len_; }
+    bool empty() const { return len_ == 0; }
+
+    /// `delay_ns` sonra dolacak bir zamanlayıcı ekler; dolunca on_fire(token) çağrılır.
+    TimerId insert(uint64_t delay_ns, uint64_t token) {
+        uint32_t index = free_head_;
+        if (index == kNil) {
+            index = static_cast<uint32_t>(nodes_.size());
+            nodes_.push_back(Node{});
+        } else {
+            free_head_ = nodes_[index].next;
+        }
+        // Taşmayan yukarı yuvarlamalı bölme; dolma tiki UINT64_MAX'ta doyar
+        uint64_t ticks = delay_ns / tick_ns_ + (delay_ns % tick_ns_ != 0 ? 1 : 0);
+        if (ticks == 0) {
+            ticks = 1;
+        }
+        Node& node = nodes_[index];
+        node.expires = ticks > UINT64_MAX - now_ ? UINT64_MAX : now_ + ticks;
+        node.token = token;
+        link(index);
+        ++len_;
+        return TimerId{index, node.generation};
+    }
+
+    /// Zamanlayıcıyı iptal eder. Zaten dolmuş veya iptal edilmişse false döner.
+    bool cancel(TimerId id) {
+        if (id.index >= nodes_.size()) {
+            return false;
+        }
+        const Node& node = nodes_[id.index];
+        if (node.generation != id.generation || node.slot == kNil) {
+            return false;
+        }
+        unlink(id.index);
+        release(id.index);
+        return true;
+    }
+
+    /// Çarkı `now_ns` anına ilerletir ve dolan her zamanlayıcı için on_fire(token) çağırır.
+    /// Geri çağırma içinde insert/cancel yapılabilir. Dolan zamanlayıcı sayısını döner.
+    template <typename F>
+    size_t advance(uint64_t now_ns, F&& on_fire) {
+        uint64_t target = (now_ns > origin_ns_ ? now_ns - origin_ns_ : 0) / tick_ns_;
+        size_t fired = 0;
+        while (now_ < target) {
+            if (len_ == 0) {
+                now_ = target;
+                break;
+            }
+            if (occupied_[0] == 0) {
+                // Seviye 0 boş: bir sonraki kaskad sınırına kadar atla
+                uint64_t before_boundary = now_ | kSlotMask;
+                if (before_boundary >= target) {
+                    now_ = target;
+                    break;
+                }
+                now_ = before_boundary;
+            }
+            ++now_;
+            cascade();
+            size_t slot = static_cast<size_t>(now_ & kSlotMask);
+            // Düğümler baştan birer birer alınır: geri çağırmadaki cancel tutarlı bir liste görür
+            uint32_t index = kNil;
+            while ((index = heads_[0][slot]) != kNil) {
+                uint64_t token = nodes_[index].token;
+                unlink(index);
+                release(index);
+                on_fire(token);
+                ++fired;
+            }
+        }
+        return fired;
+    }
+
+    /// Bir sonraki dolma anı (mutlak ns); çark boşsa false döner.
+    /// Üst seviyelerdeki yuvalar için kaskad anı döner (erken uyanma, kaskad sonrası yeniden kurulur).
+    bool next_deadline_ns(uint64_t* out_ns) const {
+        bool found = false;
+        uint64_t earliest = 0;
+        for (size_t level = 0; level < kLevels; ++level) {
+            uint64_t bits = occupied_[level];
+            if (bits == 0) {
+                continue;
+            }
+            unsigned shift = kSlotBits * static_cast<unsigned>(level);
+            unsigned current = static_cast<unsigned>((now_ >> shift) & kSlotMask);
+            unsigned rot = (current + 1) % kSlots;
+            uint64_t rotated = rot == 0 ? bits : ((bits >> rot) | (bits << (64 - rot)));
+            uint64_t distance = static_cast<uint64_t>(__builtin_ctzll(rotated)) + 1;
+            uint64_t tick = ((now_ >> shift) + distance) << shift;
+            if (!found || tick < earliest) {
+                earliest = tick;
+                found = true;
+            }
+        }
+        if (found) {
+            *out_ns = origin_ns_ + earliest * tick_ns_;
+        }
+        return found;
+    }
+
+    /// Çekirdek zamanlayıcısını bir sonraki dolma anına kurar (çark boşsa durdurur).
+    sahne_error_t arm(sahne_handle_t timer_handle) const {
+        uint64_t at = 0;
+        if (!next_deadline_ns(&at)) {
+            return sahne_timer_set(timer_handle, 0, 0, SAHNE_TIMER_RELATIVE);
+        }
+        return sahne_timer_set(timer_handle, at == 0 ? 1 : at, 0, SAHNE_TIMER_ABSOLUTE);
+    }
+
+private:
+    static constexpr size_t kLevels = 4;
+    static constexpr unsigned kSlotBits = 6;
+    static constexpr size_t kSlots = size_t{1} << kSlotBits;
+    static constexpr uint64_t kSlotMask = kSlots - 1;
+    static constexpr uint32_t kNil = UINT32_MAX;
+    static constexpr uint64_t kMaxDelta = uint64_t{1} << (kSlotBits * kLevels);
+
+    struct Node {
+        uint64_t expires = 0;
+        uint64_t token = 0;
+        uint32_t next = kNil;
+        uint32_t prev = kNil;
+        uint32_t slot = kNil; // level * kSlots + yuva, kNil = boşta
+        uint32_t generation = 0;
+    };
+
+    void cascade() {
+        for (size_t level = 1; level < kLevels; ++level) {
+            unsigned shift = kSlotBits * static_cast<unsigned>(level);
+            if ((now_ & ((uint64_t{1} << shift) - 1)) != 0) {
+                break; // Bu seviyenin sınırında değiliz, üst seviyeler de değil
+            }
+            size_t slot = static_cast<size_t>((now_ >> shift) & kSlotMask);
+            uint32_t index = heads_[level][slot];
+            heads_[level][slot] = kNil;
+            occupied_[level] &= ~(uint64_t{1} << slot);
+            while (index != kNil) {
+                uint32_t next = nodes_[index].next;
+                link(index); // Şimdiki zamana göre daha alt seviyeye yerleşir
+                index = next;
+            }
+        }
+    }
+
+    void link(uint32_t index) {
+        uint64_t expires = nodes_[index].expires;
+        // Dolmuş düğüm (kaskad sınırında) delta 0 ile şimdi boşaltılacak yuvaya düşer
+        uint64_t delta = expires > now_ ? expires - now_ : 0;
+        size_t level = 0;
+        size_t slot = 0;
+        if (delta >= kMaxDelta) {
+            // Aralık dışı: en üst seviyenin en uzak yuvasına koy, kaskadda yeniden değerlendirilir
+            level = kLevels - 1;
+            slot = static_cast<size_t>(((now_ + kMaxDelta - 1) >> (kSlotBits * level)) & kSlotMask);
+        } else {
+            while (level + 1 < kLevels && delta >= (uint64_t{1} << (kSlotBits * (level + 1)))) {
+                ++level;
+            }
+            slot = static_cast<size_t>(((now_ + delta) >> (kSlotBits * level)) & kSlotMask);
+        }
+        uint32_t head = heads_[level][slot];
+        Node& node = nodes_[index];
+        node.slot = static_cast<uint32_t>(level * kSlots + slot);
+        node.prev = kNil;
+        node.next = head;
+        if (head != kNil) {
+            nodes_[head].prev = index;
+        }
+        heads_[level][slot] = index;
+        occupied_[level] |= uint64_t{1} << slot;
+    }
+
+    void unlink(uint32_t index) {
+        const Node node = nodes_[index];
+        size_t level = node.slot / kSlots;
+        size_t slot = node.slot % kSlots;
+        if (node.prev != kNil) {
+            nodes_[node.prev].next = node.next;
+        } else {
+            heads_[level][slot] = node.next;
+        }
+        if (node.next != kNil) {
+            nodes_[node.next].prev = node.prev;
+        }
+        if (heads_[level][slot] == kNil) {
+            occupied_[level] &= ~(uint64_t{1} << slot);
+        }
+        nodes_[index].slot = kNil;
+    }
+
+    void release(uint32_t index) {
+        Node& node = nodes_[index];
+        node.slot = kNil;
+        ++node.generation;
+        node.prev = kNil;
+        node.next = free_head_;
+        free_head_ = index;
+        --len_;
+    }
+
+    std::vector<Node> nodes_;
+    uint32_t heads_[kLevels][kSlots];
+    uint64_t occupied_[kLevels] = {0, 0, 0, 0};
+    uint32_t free_head_ = kNil;
+    uint64_t tick_ns_;
+    uint64_t origin_ns_;
+    uint64_t now_ = 0;
+    size_t len_ = 0;
+};
+
+} // namespace timer
+} // namespace sahne
+
+#endif // SAHNE_TIMER_WHEEL_HPP
@@ -0,0 +1,148 @@
+#ifndef SAHNE_TREE_WALK_HPP
+#define SAHNE_TREE_WALK_HPP
+
+// sahne:// isim alanları için paralel ağaç gezgini (sahne64.rs walk modülünün C++ karşılığı).
+// Her dizin sahne_resource_enumerate ile tampon dolusu listelenir; girdiler durum bilgisini taşıdığından
+// girdi başına acquire + stat + release gerekmez. Alt dizinler ortak bir kuyruğa eklenir ve bir
+// iş parçacığı havuzu tarafından paralel gezilir.
+
+#include "sahne.h"
+#include "sahne.hpp"
+
+#include <algorithm>          // std::max
+#include <atomic>             // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <cstdint>
+#include <deque>              // std::deque
+#include <functional>         // std::function
+#include <mutex>              // std::mutex
+#include <string>
+#include <thread>             // std::thread
+#include <utility>            // std::move
+#include <vector>
+
+namespace sahne {
+namespace resource {
+
+struct TreeWalkOptions {
+    size_t threads = 0;              // 0: std::thread::hardware_concurrency()
+    size_t buffer_bytes = 64 * 1024; // İş parçacığı başına listeleme tamponu
+};
+
+class TreeWalker {
+public:
+    using Options = TreeWalkOptions;
+
+    /// (dizin yolu, girdi) için çağrılır. Birden çok iş parçacığından eşzamanlı çağrılabilir.
+    using Visitor = std::function<void(const std::string& dir_path, const DirEntryView& entry)>;
+
+    /// `root` altındaki tüm girdileri gezer. İlk hatada gezinme durur ve o hata döner.
+    /// *out_entries (nullptr değilse) ziyaret edilen girdi sayısını alır.
+    static sahne_error_t walk(const std::string& root, const Visitor& visitor, const Options& options = Options(),
+                              uint64_t* out_entries = nullptr) {
+        State state(visitor, options.buffer_bytes);
+        state.queue.push_back(root);
+        state.pending = 1;
+
+        size_t threads = options.threads;
+        if (threads == 0) {
+            threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        for (size_t i = 1; i < threads; ++i) {
+            workers.emplace_back([&state] { run(state); });
+        }
+        run(state); // Çağıran iş parçacığı da işçi olarak çalışır
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        if (out_entries != nullptr) {
+            *out_entries = state.entries.load(std::memory_order_relaxed);
+        }
+        return state.error;
+    }
+
+private:
+    struct State {
+        State(const Visitor& v, size_t bytes) : visitor(v), buffer_bytes(bytes) {}
+
+        const Visitor& visitor;
+        size_t buffer_bytes;
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<std::string> queue;
+        size_t pending = 0; // Kuyruktaki + işlenmekte olan dizin sayısı; 0 olunca gezinme biter
+        bool stop = false;
+        sahne_error_t error = SAHNE_SUCCESS;
+        std::atomic<uint64_t> entries{0};
+    };
+
+    static void run(State& state) {
+        std::vector<uint8_t> buffer(state.buffer_bytes);
+        std::vector<std::string> children;
+        for (;;) {
+            std::string dir;
+            {
+                std::unique_lock<std::mutex> lock(state.mutex);
+                state.cv.wait(lock, [&state] { return state.stop || !state.queue.empty() || state.pending == 0; });
+                if (state.stop || state.queue.empty()) {
+                    return;
+                }
+                dir = std::move(state.queue.front());
+                state.queue.pop_front();
+            }
+
+            children.clear();
+            sahne_error_t err = walk_dir(state, dir, buffer, children);
+
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (err != SAHNE_SUCCESS && state.error == SAHNE_SUCCESS) {
+                state.error = err;
+                state.stop = true;
+            }
+            if (!state.stop) {
+                for (auto& child : children) {
+                    state.queue.push_back(std::move(child));
+                }
+                state.pending += children.size();
+            }
+            --state.pending;
+            state.cv.notify_all();
+        }
+    }
+
+    static sahne_error_t walk_dir(State& state, const std::string& dir, std::vector<uint8_t>& buffer,
+                                  std::vector<std::string>& children) {
+        sahne_handle_t handle = 0;
+        sahne_error_t err = sahne_resource_acquire(reinterpret_cast<const uint8_t*>(dir.data()), dir.size(), SAHNE_MODE_READ, &handle);
+        if (err != SAHNE_SUCCESS) {
+            return err;
+        }
+        uint64_t visited = 0;
+        err = for_each_entry(handle, buffer, [&](const DirEntryView& entry) {
+            state.visitor(dir, entry);
+            ++visited;
+            if (entry.is_directory()) {
+                std::string child;
+                child.reserve(dir.size() + 1 + entry.name.size());
+                child.append(dir);
+                if (child.empty() || child.back() != '/') {
+                    child.push_back('/'); // "sahne://" gibi '/' ile biten köklerde ayırıcı çiftlenmez
+                }
+                child.append(entry.name.data(), entry.name.size());
+                children.push_back(std::move(child));
+            }
+            return true;
+        });
+        sahne_resource_release(handle);
+        state.entries.fetch_add(visited, std::memory_order_relaxed);
+        return err;
+    }
+};
+
+} // namespace resource
+} // namespace sahne
+
+#endif // SAHNE_TREE_WALK_HPP